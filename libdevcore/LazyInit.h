@@ -0,0 +1,127 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Caches for values that are computed on first use and read concurrently without locking.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace dev
+{
+
+/**
+ * Lazily computed value that can be queried from several threads without locking.
+ *
+ * The first query computes the value and publishes it with an atomic compare-and-swap,
+ * all later queries only perform an atomic load. If several threads compute the value
+ * at the same time, the first published result is used and the others are discarded,
+ * so the computation must not have side-effects apart from filling other caches.
+ * Copies start out empty. reset() must not overlap with any other access.
+ */
+template <class T>
+class LazyInit
+{
+public:
+	LazyInit() = default;
+	LazyInit(LazyInit const&) {}
+	LazyInit(LazyInit&& _other) noexcept: m_value(_other.m_value.exchange(nullptr)) {}
+	LazyInit& operator=(LazyInit const&) { reset(); return *this; }
+	~LazyInit() { reset(); }
+
+	/// @returns the value, calling @a _compute() to compute it if it is not yet known.
+	template <class Compute>
+	T const& get(Compute const& _compute)
+	{
+		if (T const* value = m_value.load(std::memory_order_acquire))
+			return *value;
+		std::unique_ptr<T> computed(new T(_compute()));
+		T* published = nullptr;
+		if (m_value.compare_exchange_strong(published, computed.get(), std::memory_order_acq_rel))
+			return *computed.release();
+		return *published;
+	}
+	/// @returns the value if it is already known and nullptr otherwise.
+	T const* peek() const { return m_value.load(std::memory_order_acquire); }
+	void reset() { delete m_value.exchange(nullptr); }
+
+private:
+	std::atomic<T*> m_value{nullptr};
+};
+
+/**
+ * Map of lazily computed values with the same guarantees as LazyInit.
+ * Intended for few keys, since lookups are linear in the number of keys.
+ */
+template <class Key, class T>
+class LazyInitMap
+{
+public:
+	LazyInitMap() = default;
+	LazyInitMap(LazyInitMap const&) {}
+	LazyInitMap& operator=(LazyInitMap const&) { clear(); return *this; }
+	~LazyInitMap() { clear(); }
+
+	/// @returns the value for @a _key, calling @a _compute() to compute it if it is not yet known.
+	template <class Compute>
+	T const& get(Key const& _key, Compute const& _compute)
+	{
+		Node* seen = m_head.load(std::memory_order_acquire);
+		if (T const* value = find(seen, nullptr, _key))
+			return *value;
+		std::unique_ptr<Node> node(new Node{_key, _compute(), seen});
+		// Nodes are only ever prepended, so on failure only the ones added since the
+		// last attempt have to be searched.
+		while (!m_head.compare_exchange_weak(node->next, node.get(), std::memory_order_acq_rel))
+		{
+			if (T const* value = find(node->next, seen, _key))
+				return *value;
+			seen = node->next;
+		}
+		return node.release()->value;
+	}
+	void clear()
+	{
+		for (Node* node = m_head.exchange(nullptr); node;)
+			delete std::exchange(node, node->next);
+	}
+
+private:
+	struct Node
+	{
+		Key key;
+		T value;
+		Node* next;
+	};
+
+	/// @returns the value of the first node with key @a _key from @a _begin up to
+	/// (not including) @a _end and nullptr if there is none.
+	static T const* find(Node const* _begin, Node const* _end, Key const& _key)
+	{
+		for (Node const* node = _begin; node != _end; node = node->next)
+			if (node->key == _key)
+				return &node->value;
+		return nullptr;
+	}
+
+	std::atomic<Node*> m_head{nullptr};
+};
+
+}
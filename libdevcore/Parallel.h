@@ -0,0 +1,86 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Helpers for running independent work items on multiple threads.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace dev
+{
+
+/// @returns the number of worker threads to use for @a _items work items
+/// if at most @a _jobs threads are requested. A value of zero for @a _jobs
+/// selects the number of hardware threads.
+inline unsigned workerCount(size_t _items, unsigned _jobs)
+{
+	if (_jobs == 0)
+		_jobs = std::max(1u, std::thread::hardware_concurrency());
+	return unsigned(std::max<size_t>(1, std::min<size_t>(_items, _jobs)));
+}
+
+/// Calls @a _task(index, worker) for every index in [0, _items) using @a _workers threads.
+/// Indices are handed out dynamically in increasing order, so that slow items do not
+/// stall the others. @a worker is the index of the thread in [0, _workers) that runs the
+/// item and can be used to access per-thread state prepared by the caller.
+/// If @a _workers is one, everything runs on the calling thread.
+/// If tasks throw, the exception of the item with the lowest index is re-thrown on the
+/// calling thread after all threads have finished, independent of scheduling.
+template <typename Task>
+void parallelFor(size_t _items, unsigned _workers, Task const& _task)
+{
+	if (_workers <= 1 || _items <= 1)
+	{
+		for (size_t i = 0; i < _items; ++i)
+			_task(i, 0u);
+		return;
+	}
+
+	std::atomic<size_t> next{0};
+	std::vector<std::exception_ptr> exceptions(_items);
+	auto work = [&](unsigned _worker)
+	{
+		for (size_t i = next++; i < _items; i = next++)
+			try
+			{
+				_task(i, _worker);
+			}
+			catch (...)
+			{
+				exceptions[i] = std::current_exception();
+			}
+	};
+
+	std::vector<std::thread> threads;
+	for (unsigned worker = 1; worker < _workers; ++worker)
+		threads.emplace_back(work, worker);
+	work(0);
+	for (auto& thread: threads)
+		thread.join();
+
+	for (auto const& exception: exceptions)
+		if (exception)
+			std::rethrow_exception(exception);
+}
+
+}
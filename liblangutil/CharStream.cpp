@@ -53,6 +53,8 @@
 #include <liblangutil/CharStream.h>
 #include <liblangutil/Exceptions.h>
 
+#include <algorithm>
+
 using namespace std;
 using namespace langutil;
 
@@ -92,19 +94,37 @@ string CharStream::lineAtPosition(int _position) const
 }
 
 tuple<int, int> CharStream::translatePositionToLineColumn(int _position) const
+{
+	return translatePositionsToLineColumns({_position}).front();
+}
+
+vector<tuple<int, int>> CharStream::translatePositionsToLineColumns(vector<int> const& _positions) const
 {
 	using size_type = string::size_type;
-	size_type searchPosition = min<size_type>(m_source.size(), _position);
-	int lineNumber = count(m_source.begin(), m_source.begin() + searchPosition, '\n');
-	size_type lineStart;
-	if (searchPosition == 0)
-		lineStart = 0;
-	else
+	shared_ptr<vector<size_t> const> starts = lineStarts();
+	vector<tuple<int, int>> result;
+	result.reserve(_positions.size());
+	for (int position: _positions)
 	{
-		lineStart = m_source.rfind('\n', searchPosition - 1);
-		lineStart = lineStart == string::npos ? 0 : lineStart + 1;
+		size_type searchPosition = min<size_type>(m_source.size(), position);
+		// The line is the number of line starts after the first one up to and including the position.
+		auto lineStart = upper_bound(starts->begin(), starts->end(), searchPosition) - 1;
+		result.emplace_back(lineStart - starts->begin(), searchPosition - *lineStart);
 	}
-	return tuple<int, int>(lineNumber, searchPosition - lineStart);
+	return result;
 }
 
-
+shared_ptr<vector<size_t> const> CharStream::lineStarts() const
+{
+	shared_ptr<vector<size_t> const> starts = atomic_load(&m_lineStarts);
+	if (!starts)
+	{
+		auto newStarts = make_shared<vector<size_t>>(1, 0);
+		for (size_t i = 0; i < m_source.size(); ++i)
+			if (m_source[i] == '\n')
+				newStarts->push_back(i + 1);
+		starts = move(newStarts);
+		atomic_store(&m_lineStarts, starts);
+	}
+	return starts;
+}
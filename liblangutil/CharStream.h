@@ -53,8 +53,10 @@
 #pragma once
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <tuple>
+#include <vector>
 
 namespace langutil
 {
@@ -86,15 +88,23 @@ public:
 	///@{
 	///@name Error printing helper functions
 	/// Functions that help pretty-printing parse errors
-	/// Do only use in error cases, they are quite expensive.
 	std::string lineAtPosition(int _position) const;
+	/// @returns the zero-based line and column of @a _position.
+	/// Uses an index of line starts that is built on first use, so repeated calls are cheap.
 	std::tuple<int, int> translatePositionToLineColumn(int _position) const;
+	/// Same as translatePositionToLineColumn for each of @a _positions.
+	std::vector<std::tuple<int, int>> translatePositionsToLineColumns(std::vector<int> const& _positions) const;
 	///@}
 
 private:
+	/// @returns the offsets at which the lines of the source start, building them if needed.
+	std::shared_ptr<std::vector<size_t> const> lineStarts() const;
+
 	std::string m_source;
 	std::string m_name;
 	size_t m_position{0};
+	/// Line start index, accessed atomically since the stream can be shared between threads.
+	mutable std::shared_ptr<std::vector<size_t> const> m_lineStarts;
 };
 
 }
@@ -45,10 +45,8 @@ public:
 
 	ErrorReporter& operator=(ErrorReporter const& _errorReporter);
 
-	void append(ErrorList const& _errorList)
-	{
-		m_errorList += _errorList;
-	}
+	/// Appends the errors of @a _errorList, applying the same limits as when they are reported.
+	void append(ErrorList const& _errorList);
 
 	void warning(std::string const& _description);
 
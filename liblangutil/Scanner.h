@@ -160,6 +160,10 @@ public:
 	/// Do only use in error cases, they are quite expensive.
 	std::string lineAtPosition(int _position) const { return m_source->lineAtPosition(_position); }
 	std::tuple<int, int> translatePositionToLineColumn(int _position) const { return m_source->translatePositionToLineColumn(_position); }
+	std::vector<std::tuple<int, int>> translatePositionsToLineColumns(std::vector<int> const& _positions) const
+	{
+		return m_source->translatePositionsToLineColumns(_positions);
+	}
 	std::string sourceAt(SourceLocation const& _location) const
 	{
 		solAssert(!_location.isEmpty(), "");
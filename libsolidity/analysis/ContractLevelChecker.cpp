@@ -105,15 +105,19 @@ void ContractLevelChecker::findDuplicateDefinitions(map<string, vector<T>> const
 	for (auto const& it: _definitions)
 	{
 		vector<T> const& overloads = it.second;
+		// Indices of the overloads, grouped by their parameter types.
+		unordered_map<string, vector<size_t>> overloadsByParameterTypes;
+		for (size_t i = 0; i < overloads.size(); ++i)
+			overloadsByParameterTypes[callableSignature(*overloads[i]).parameterTypesKey].push_back(i);
+
 		set<size_t> reported;
 		for (size_t i = 0; i < overloads.size() && !reported.count(i); ++i)
 		{
 			SecondarySourceLocation ssl;
 
-			for (size_t j = i + 1; j < overloads.size(); ++j)
-				if (FunctionType(*overloads[i]).asCallableFunction(false)->hasEqualParameterTypes(
-					*FunctionType(*overloads[j]).asCallableFunction(false))
-				)
+			// All earlier overloads of the group were reported already, so the others come after i.
+			for (size_t j: overloadsByParameterTypes.at(callableSignature(*overloads[i]).parameterTypesKey))
+				if (j > i)
 				{
 					ssl.append("Other declaration is here:", overloads[j]->location());
 					reported.insert(j);
@@ -137,7 +141,8 @@ void ContractLevelChecker::checkIllegalOverrides(ContractDefinition const& _cont
 {
 	// TODO unify this at a later point. for this we need to put the constness and the access specifier
 	// into the types
-	map<string, vector<FunctionDefinition const*>> functions;
+	// Functions by name and parameter types, since only functions with equal parameter types override each other.
+	map<string, unordered_map<string, vector<FunctionDefinition const*>>> functions;
 	map<string, ModifierDefinition const*> modifiers;
 
 	// We search from derived to base, so the stored item causes the error.
@@ -151,10 +156,11 @@ void ContractLevelChecker::checkIllegalOverrides(ContractDefinition const& _cont
 			if (modifiers.count(name))
 				m_errorReporter.typeError(modifiers[name]->location(), "Override changes function to modifier.");
 
-			for (FunctionDefinition const* overriding: functions[name])
+			vector<FunctionDefinition const*>& overloads = functions[name][callableSignature(*function).parameterTypesKey];
+			for (FunctionDefinition const* overriding: overloads)
 				checkFunctionOverride(*overriding, *function);
 
-			functions[name].push_back(function);
+			overloads.push_back(function);
 		}
 		for (ModifierDefinition const* modifier: contract->functionModifiers())
 		{
@@ -172,8 +178,8 @@ void ContractLevelChecker::checkIllegalOverrides(ContractDefinition const& _cont
 
 void ContractLevelChecker::checkFunctionOverride(FunctionDefinition const& _function, FunctionDefinition const& _super)
 {
-	FunctionTypePointer functionType = FunctionType(_function).asCallableFunction(false);
-	FunctionTypePointer superType = FunctionType(_super).asCallableFunction(false);
+	FunctionTypePointer functionType = callableSignature(_function).type;
+	FunctionTypePointer superType = callableSignature(_super).type;
 
 	if (!functionType->hasEqualParameterTypes(*superType))
 		return;
@@ -402,7 +408,7 @@ void ContractLevelChecker::checkFallbackFunction(ContractDefinition const& _cont
 
 void ContractLevelChecker::checkExternalTypeClashes(ContractDefinition const& _contract)
 {
-	map<string, vector<pair<Declaration const*, FunctionTypePointer>>> externalDeclarations;
+	map<string, vector<pair<Declaration const*, string>>> externalDeclarations;
 	for (ContractDefinition const* contract: _contract.annotation().linearizedBaseContracts)
 	{
 		for (FunctionDefinition const* f: contract->definedFunctions())
@@ -412,7 +418,7 @@ void ContractLevelChecker::checkExternalTypeClashes(ContractDefinition const& _c
 				// under non error circumstances this should be true
 				if (functionType->interfaceFunctionType())
 					externalDeclarations[functionType->externalSignature()].emplace_back(
-						f, functionType->asCallableFunction(false)
+						f, parameterTypesKey(*functionType->asCallableFunction(false))
 					);
 			}
 		for (VariableDeclaration const* v: contract->stateVariables())
@@ -422,18 +428,25 @@ void ContractLevelChecker::checkExternalTypeClashes(ContractDefinition const& _c
 				// under non error circumstances this should be true
 				if (functionType->interfaceFunctionType())
 					externalDeclarations[functionType->externalSignature()].emplace_back(
-						v, functionType->asCallableFunction(false)
+						v, parameterTypesKey(*functionType->asCallableFunction(false))
 					);
 			}
 	}
 	for (auto const& it: externalDeclarations)
-		for (size_t i = 0; i < it.second.size(); ++i)
-			for (size_t j = i + 1; j < it.second.size(); ++j)
-				if (!it.second[i].second->hasEqualParameterTypes(*it.second[j].second))
-					m_errorReporter.typeError(
-						it.second[j].first->location(),
-						"Function overload clash during conversion to external types for arguments."
-					);
+	{
+		// Number of declarations seen so far, by parameter types.
+		unordered_map<string, size_t> seen;
+		for (size_t j = 0; j < it.second.size(); ++j)
+		{
+			// One error for each earlier declaration with different parameter types.
+			size_t clashes = j - seen[it.second[j].second]++;
+			for (size_t i = 0; i < clashes; ++i)
+				m_errorReporter.typeError(
+					it.second[j].first->location(),
+					"Function overload clash during conversion to external types for arguments."
+				);
+		}
+	}
 }
 
 void ContractLevelChecker::checkHashCollisions(ContractDefinition const& _contract)
@@ -510,3 +523,32 @@ void ContractLevelChecker::checkBaseABICompatibility(ContractDefinition const& _
 		);
 
 }
+
+string ContractLevelChecker::parameterTypesKey(FunctionType const& _functionType)
+{
+	string key;
+	for (Type const* type: _functionType.parameterTypes())
+		key += type->richIdentifier() + ",";
+	return key;
+}
+
+ContractLevelChecker::CallableSignature const& ContractLevelChecker::callableSignature(
+	CallableDeclaration const& _declaration
+)
+{
+	auto it = m_callableSignatures.find(&_declaration);
+	if (it == m_callableSignatures.end())
+	{
+		FunctionTypePointer type = nullptr;
+		if (auto const* function = dynamic_cast<FunctionDefinition const*>(&_declaration))
+			type = FunctionType(*function).asCallableFunction(false);
+		else
+		{
+			auto const* event = dynamic_cast<EventDefinition const*>(&_declaration);
+			solAssert(event, "");
+			type = FunctionType(*event).asCallableFunction(false);
+		}
+		it = m_callableSignatures.emplace(&_declaration, CallableSignature{type, parameterTypesKey(*type)}).first;
+	}
+	return it->second;
+}
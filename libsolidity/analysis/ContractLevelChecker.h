@@ -23,6 +23,9 @@
 
 #include <libsolidity/ast/ASTForward.h>
 #include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace langutil
 {
@@ -34,6 +37,9 @@ namespace dev
 namespace solidity
 {
 
+class CallableDeclaration;
+class FunctionType;
+
 /**
  * Component that verifies overloads, abstract contracts, function clashes and others
  * checks at contract or function level.
@@ -81,7 +87,22 @@ private:
 	/// Checks base contracts for ABI compatibility
 	void checkBaseABICompatibility(ContractDefinition const& _contract);
 
+	/// @returns a key that is equal for two function types if and only if their
+	/// parameter types are equal.
+	static std::string parameterTypesKey(FunctionType const& _functionType);
+
+	struct CallableSignature
+	{
+		FunctionType const* type;
+		/// parameterTypesKey of type.
+		std::string parameterTypesKey;
+	};
+	/// @returns the callable function type of @a _declaration and its parameter types key.
+	/// These are cached, since all base contracts are checked again for each derived contract.
+	CallableSignature const& callableSignature(CallableDeclaration const& _declaration);
+
 	langutil::ErrorReporter& m_errorReporter;
+	std::unordered_map<CallableDeclaration const*, CallableSignature> m_callableSignatures;
 };
 
 }
@@ -25,7 +25,7 @@ namespace dev
 namespace solidity
 {
 
-class ControlFlowAnalyzer: private ASTConstVisitor
+class ControlFlowAnalyzer: public ASTConstVisitor
 {
 public:
 	explicit ControlFlowAnalyzer(CFG const& _cfg, langutil::ErrorReporter& _errorReporter):
@@ -123,7 +123,7 @@ struct FunctionFlow
 	CFGNode* revert = nullptr;
 };
 
-class CFG: private ASTConstVisitor
+class CFG: public ASTConstVisitor
 {
 public:
 	explicit CFG(langutil::ErrorReporter& _errorReporter): m_errorReporter(_errorReporter) {}
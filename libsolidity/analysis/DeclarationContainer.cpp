@@ -26,6 +26,8 @@
 #include <libsolidity/ast/Types.h>
 #include <libdevcore/StringUtils.h>
 
+#include <algorithm>
+
 using namespace std;
 using namespace dev;
 using namespace dev::solidity;
@@ -39,10 +41,9 @@ Declaration const* DeclarationContainer::conflictingDeclaration(
 		_name = &_declaration.name();
 	solAssert(!_name->empty(), "");
 	vector<Declaration const*> declarations;
-	if (m_declarations.count(*_name))
-		declarations += m_declarations.at(*_name);
-	if (m_invisibleDeclarations.count(*_name))
-		declarations += m_invisibleDeclarations.at(*_name);
+	appendDeclarations(m_declarations, *_name, declarations);
+	appendDeclarations(m_inheritedDeclarations, *_name, declarations);
+	appendDeclarations(m_invisibleDeclarations, *_name, declarations);
 
 	if (
 		dynamic_cast<FunctionDefinition const*>(&_declaration) ||
@@ -89,6 +90,7 @@ void DeclarationContainer::activateVariable(ASTString const& _name)
 	solAssert(m_declarations.count(_name) == 0 || m_declarations.at(_name).empty(), "");
 	m_declarations[_name].emplace_back(m_invisibleDeclarations.at(_name).front());
 	m_invisibleDeclarations.erase(_name);
+	m_ownDeclarations.reset();
 }
 
 bool DeclarationContainer::isInvisible(ASTString const& _name) const
@@ -112,6 +114,7 @@ bool DeclarationContainer::registerDeclaration(
 	{
 		solAssert(!dynamic_cast<FunctionDefinition const*>(&_declaration), "Attempt to update function definition.");
 		m_declarations.erase(*_name);
+		m_inheritedDeclarations.erase(*_name);
 		m_invisibleDeclarations.erase(*_name);
 	}
 	else if (conflictingDeclaration(_declaration, _name))
@@ -120,17 +123,58 @@ bool DeclarationContainer::registerDeclaration(
 	vector<Declaration const*>& decls = _invisible ? m_invisibleDeclarations[*_name] : m_declarations[*_name];
 	if (!contains(decls, &_declaration))
 		decls.push_back(&_declaration);
+	m_ownDeclarations.reset();
 	return true;
 }
 
+bool DeclarationContainer::registerInheritedDeclaration(Declaration const& _declaration)
+{
+	ASTString const& name = _declaration.name();
+	if (name.empty())
+		return true;
+	if (conflictingDeclaration(_declaration))
+		return false;
+
+	vector<Declaration const*>& decls = m_inheritedDeclarations[name];
+	if (!contains(decls, &_declaration))
+		decls.push_back(&_declaration);
+	return true;
+}
+
+map<ASTString, vector<Declaration const*>> DeclarationContainer::declarations() const
+{
+	map<ASTString, vector<Declaration const*>> declarations(m_declarations.begin(), m_declarations.end());
+	for (auto const& nameAndDeclarations: m_inheritedDeclarations)
+		declarations[nameAndDeclarations.first] += nameAndDeclarations.second;
+	return declarations;
+}
+
+vector<Declaration const*> const& DeclarationContainer::ownDeclarations() const
+{
+	if (!m_ownDeclarations)
+	{
+		vector<DeclarationMap::value_type const*> sortedDeclarations;
+		for (auto const& nameAndDeclarations: m_declarations)
+			sortedDeclarations.push_back(&nameAndDeclarations);
+		sort(sortedDeclarations.begin(), sortedDeclarations.end(), [](auto const* _a, auto const* _b) {
+			return _a->first < _b->first;
+		});
+
+		m_ownDeclarations = make_unique<vector<Declaration const*>>();
+		for (auto const* nameAndDeclarations: sortedDeclarations)
+			*m_ownDeclarations += nameAndDeclarations->second;
+	}
+	return *m_ownDeclarations;
+}
+
 vector<Declaration const*> DeclarationContainer::resolveName(ASTString const& _name, bool _recursive, bool _alsoInvisible) const
 {
 	solAssert(!_name.empty(), "Attempt to resolve empty name.");
 	vector<Declaration const*> result;
-	if (m_declarations.count(_name))
-		result = m_declarations.at(_name);
-	if (_alsoInvisible && m_invisibleDeclarations.count(_name))
-		result += m_invisibleDeclarations.at(_name);
+	appendDeclarations(m_declarations, _name, result);
+	appendDeclarations(m_inheritedDeclarations, _name, result);
+	if (_alsoInvisible)
+		appendDeclarations(m_invisibleDeclarations, _name, result);
 	if (result.empty() && _recursive && m_enclosingContainer)
 		result = m_enclosingContainer->resolveName(_name, true, _alsoInvisible);
 	return result;
@@ -145,21 +189,35 @@ vector<ASTString> DeclarationContainer::similarNames(ASTString const& _name) con
 
 	vector<ASTString> similar;
 	size_t maximumEditDistance = _name.size() > 3 ? 2 : _name.size() / 2;
-	for (auto const& declaration: m_declarations)
-	{
-		string const& declarationName = declaration.first;
-		if (stringWithinDistance(_name, declarationName, maximumEditDistance, MAXIMUM_LENGTH_THRESHOLD))
-			similar.push_back(declarationName);
-	}
-	for (auto const& declaration: m_invisibleDeclarations)
+	auto findSimilar = [&](vector<DeclarationMap const*> const& _maps)
 	{
-		string const& declarationName = declaration.first;
-		if (stringWithinDistance(_name, declarationName, maximumEditDistance, MAXIMUM_LENGTH_THRESHOLD))
-			similar.push_back(declarationName);
-	}
+		// The maps are unordered and can share names, so sort and deduplicate the names found.
+		set<ASTString> similarInMaps;
+		for (DeclarationMap const* declarations: _maps)
+			for (auto const& declaration: *declarations)
+			{
+				string const& declarationName = declaration.first;
+				if (stringWithinDistance(_name, declarationName, maximumEditDistance, MAXIMUM_LENGTH_THRESHOLD))
+					similarInMaps.insert(declarationName);
+			}
+		similar += vector<ASTString>(similarInMaps.begin(), similarInMaps.end());
+	};
+	findSimilar({&m_declarations, &m_inheritedDeclarations});
+	findSimilar({&m_invisibleDeclarations});
 
 	if (m_enclosingContainer)
 		similar += m_enclosingContainer->similarNames(_name);
 
 	return similar;
 }
+
+void DeclarationContainer::appendDeclarations(
+	DeclarationMap const& _map,
+	ASTString const& _name,
+	vector<Declaration const*>& _result
+)
+{
+	auto declarations = _map.find(_name);
+	if (declarations != _map.end())
+		_result += declarations->second;
+}
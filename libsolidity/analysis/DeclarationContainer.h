@@ -25,7 +25,10 @@
 #include <libsolidity/ast/ASTForward.h>
 #include <boost/noncopyable.hpp>
 #include <map>
+#include <memory>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 namespace dev
 {
@@ -35,6 +38,9 @@ namespace solidity
 /**
  * Container that stores mappings between names and declarations. It also contains a link to the
  * enclosing scope.
+ * Declarations inherited from base contracts are kept in a separate layer behind the declarations
+ * of the container itself, so that base contracts can be imported without scanning what they
+ * inherited themselves.
  */
 class DeclarationContainer
 {
@@ -50,10 +56,16 @@ public:
 	/// @param _update if true, replaces a potential declaration that is already present
 	/// @returns false if the name was already declared.
 	bool registerDeclaration(Declaration const& _declaration, ASTString const* _name = nullptr, bool _invisible = false, bool _update = false);
+	/// Registers a declaration inherited from a base contract in the same way as registerDeclaration,
+	/// but without making it part of ownDeclarations.
+	bool registerInheritedDeclaration(Declaration const& _declaration);
 	std::vector<Declaration const*> resolveName(ASTString const& _name, bool _recursive = false, bool _alsoInvisible = false) const;
 	ASTNode const* enclosingNode() const { return m_enclosingNode; }
 	DeclarationContainer const* enclosingContainer() const { return m_enclosingContainer; }
-	std::map<ASTString, std::vector<Declaration const*>> const& declarations() const { return m_declarations; }
+	/// @returns all visible declarations by name.
+	std::map<ASTString, std::vector<Declaration const*>> declarations() const;
+	/// @returns all visible declarations that were not inherited from a base contract, sorted by name.
+	std::vector<Declaration const*> const& ownDeclarations() const;
 	/// @returns whether declaration is valid, and if not also returns previous declaration.
 	Declaration const* conflictingDeclaration(Declaration const& _declaration, ASTString const* _name = nullptr) const;
 
@@ -71,8 +83,16 @@ public:
 private:
 	ASTNode const* m_enclosingNode;
 	DeclarationContainer const* m_enclosingContainer;
-	std::map<ASTString, std::vector<Declaration const*>> m_declarations;
-	std::map<ASTString, std::vector<Declaration const*>> m_invisibleDeclarations;
+	using DeclarationMap = std::unordered_map<ASTString, std::vector<Declaration const*>>;
+
+	/// Appends the declarations registered under @a _name in @a _map to @a _result.
+	static void appendDeclarations(DeclarationMap const& _map, ASTString const& _name, std::vector<Declaration const*>& _result);
+
+	DeclarationMap m_declarations;
+	DeclarationMap m_inheritedDeclarations;
+	DeclarationMap m_invisibleDeclarations;
+	/// Cache for ownDeclarations(), reset whenever m_declarations changes.
+	mutable std::unique_ptr<std::vector<Declaration const*>> m_ownDeclarations;
 };
 
 }
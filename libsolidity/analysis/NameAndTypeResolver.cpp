@@ -327,42 +327,43 @@ void NameAndTypeResolver::importInheritedScope(ContractDefinition const& _base)
 {
 	auto iterator = m_scopes.find(&_base);
 	solAssert(iterator != end(m_scopes), "");
-	for (auto const& nameAndDeclaration: iterator->second->declarations())
-		for (auto const& declaration: nameAndDeclaration.second)
-			// Import if it was declared in the base, is not the constructor and is visible in derived classes
-			if (declaration->scope() == &_base && declaration->isVisibleInDerivedContracts())
-				if (!m_currentScope->registerDeclaration(*declaration))
-				{
-					SourceLocation firstDeclarationLocation;
-					SourceLocation secondDeclarationLocation;
-					Declaration const* conflictingDeclaration = m_currentScope->conflictingDeclaration(*declaration);
-					solAssert(conflictingDeclaration, "");
-
-					// Usual shadowing is not an error
-					if (dynamic_cast<VariableDeclaration const*>(declaration) && dynamic_cast<VariableDeclaration const*>(conflictingDeclaration))
-						continue;
+	// Only the declarations of the base itself are considered, since the declarations it inherited
+	// are imported from their own contracts, which are part of the linearized base contracts as well.
+	for (Declaration const* declaration: iterator->second->ownDeclarations())
+		// Import if it was declared in the base, is not the constructor and is visible in derived classes
+		if (declaration->scope() == &_base && declaration->isVisibleInDerivedContracts())
+			if (!m_currentScope->registerInheritedDeclaration(*declaration))
+			{
+				SourceLocation firstDeclarationLocation;
+				SourceLocation secondDeclarationLocation;
+				Declaration const* conflictingDeclaration = m_currentScope->conflictingDeclaration(*declaration);
+				solAssert(conflictingDeclaration, "");
 
-					// Usual shadowing is not an error
-					if (dynamic_cast<ModifierDefinition const*>(declaration) && dynamic_cast<ModifierDefinition const*>(conflictingDeclaration))
-						continue;
+				// Usual shadowing is not an error
+				if (dynamic_cast<VariableDeclaration const*>(declaration) && dynamic_cast<VariableDeclaration const*>(conflictingDeclaration))
+					continue;
 
-					if (declaration->location().start < conflictingDeclaration->location().start)
-					{
-						firstDeclarationLocation = declaration->location();
-						secondDeclarationLocation = conflictingDeclaration->location();
-					}
-					else
-					{
-						firstDeclarationLocation = conflictingDeclaration->location();
-						secondDeclarationLocation = declaration->location();
-					}
+				// Usual shadowing is not an error
+				if (dynamic_cast<ModifierDefinition const*>(declaration) && dynamic_cast<ModifierDefinition const*>(conflictingDeclaration))
+					continue;
 
-					m_errorReporter.declarationError(
-						secondDeclarationLocation,
-						SecondarySourceLocation().append("The previous declaration is here:", firstDeclarationLocation),
-						"Identifier already declared."
-					);
+				if (declaration->location().start < conflictingDeclaration->location().start)
+				{
+					firstDeclarationLocation = declaration->location();
+					secondDeclarationLocation = conflictingDeclaration->location();
+				}
+				else
+				{
+					firstDeclarationLocation = conflictingDeclaration->location();
+					secondDeclarationLocation = declaration->location();
 				}
+
+				m_errorReporter.declarationError(
+					secondDeclarationLocation,
+					SecondarySourceLocation().append("The previous declaration is here:", firstDeclarationLocation),
+					"Identifier already declared."
+				);
+			}
 }
 
 void NameAndTypeResolver::linearizeBaseContracts(ContractDefinition& _contract)
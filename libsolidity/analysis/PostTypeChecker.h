@@ -39,7 +39,7 @@ namespace solidity
  *  - whether there are circular references in constant state variables
  * @TODO factor out each use-case into an individual class (but do the traversal only once)
  */
-class PostTypeChecker: private ASTConstVisitor
+class PostTypeChecker: public ASTConstVisitor
 {
 public:
 	/// @param _errorReporter provides the error logging functionality.
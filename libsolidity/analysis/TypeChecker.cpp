@@ -1972,16 +1972,15 @@ void TypeChecker::endVisit(NewExpression const& _newExpression)
 			m_errorReporter.typeError(_newExpression.location(), "Contract with internal constructor cannot be created directly.");
 
 		solAssert(!!m_scope, "");
-		m_scope->annotation().contractDependencies.insert(contract);
 		solAssert(
 			!contract->annotation().linearizedBaseContracts.empty(),
 			"Linearized base contracts not yet available."
 		);
-		if (contractDependenciesAreCyclic(*m_scope))
-			m_errorReporter.typeError(
-				_newExpression.location(),
-				"Circular reference for contract creation (cannot create instance of derived or same contract)."
-			);
+		addContractDependency(
+			*contract,
+			_newExpression.location(),
+			"Circular reference for contract creation (cannot create instance of derived or same contract)."
+		);
 
 		_newExpression.annotation().type = FunctionType::newExpressionType(*contract);
 	}
@@ -2157,14 +2156,11 @@ bool TypeChecker::visit(MemberAccess const& _memberAccess)
 		))
 		{
 			annotation.isPure = true;
-			m_scope->annotation().contractDependencies.insert(
-				&dynamic_cast<ContractType const&>(*magicType->typeArgument()).contractDefinition()
+			addContractDependency(
+				dynamic_cast<ContractType const&>(*magicType->typeArgument()).contractDefinition(),
+				_memberAccess.location(),
+				"Circular reference for contract code access."
 			);
-			if (contractDependenciesAreCyclic(*m_scope))
-				m_errorReporter.typeError(
-					_memberAccess.location(),
-					"Circular reference for contract code access."
-				);
 		}
 		else if (magicType->kind() == MagicType::Kind::MetaType && memberName == "name")
 			annotation.isPure = true;
@@ -2420,10 +2416,44 @@ void TypeChecker::endVisit(Literal const& _literal)
 	_literal.annotation().isPure = true;
 }
 
+void TypeChecker::addContractDependencies(vector<ContractDependency> const& _dependencies, ErrorList& _errors)
+{
+	// Errors are inserted in the order of the dependencies, so every insertion shifts the
+	// positions of the following ones by one.
+	size_t inserted = 0;
+	for (auto const& dependency: _dependencies)
+	{
+		dependency.contract->annotation().contractDependencies.insert(dependency.dependency);
+		if (contractDependenciesAreCyclic(*dependency.contract))
+		{
+			ErrorList cycleErrors;
+			ErrorReporter(cycleErrors).typeError(dependency.location, dependency.cycleError);
+			_errors.insert(_errors.begin() + ptrdiff_t(dependency.errorPosition + inserted), cycleErrors.front());
+			inserted++;
+		}
+	}
+}
+
+void TypeChecker::addContractDependency(
+	ContractDefinition const& _dependency,
+	SourceLocation const& _location,
+	string const& _cycleError
+)
+{
+	if (m_deferredDependencies)
+		m_deferredDependencies->push_back({m_scope, &_dependency, _location, _cycleError, m_errorReporter.errors().size()});
+	else
+	{
+		m_scope->annotation().contractDependencies.insert(&_dependency);
+		if (contractDependenciesAreCyclic(*m_scope))
+			m_errorReporter.typeError(_location, _cycleError);
+	}
+}
+
 bool TypeChecker::contractDependenciesAreCyclic(
 	ContractDefinition const& _contract,
 	std::set<ContractDefinition const*> const& _seenContracts
-) const
+)
 {
 	// Naive depth-first search that remembers nodes already seen.
 	if (_seenContracts.count(&_contract))
@@ -53,10 +53,39 @@ public:
 		m_errorReporter(_errorReporter)
 	{}
 
+	/// Dependency of a contract on the code of another contract (via ``new`` or ``type(C).creationCode``).
+	struct ContractDependency
+	{
+		ContractDefinition const* contract;
+		ContractDefinition const* dependency;
+		langutil::SourceLocation location;
+		/// Error to report if the dependency is cyclic.
+		std::string cycleError;
+		/// Number of errors reported by the type checker before the dependency was found.
+		size_t errorPosition;
+	};
+
 	/// Performs type checking on the given contract and all of its sub-nodes.
 	/// @returns true iff all checks passed. Note even if all checks passed, errors() can still contain warnings
 	bool checkTypeRequirements(ASTNode const& _contract);
 
+	/// Records contract dependencies in @a o_dependencies instead of adding them to the contract
+	/// annotations and checking them for cycles right away. This makes it possible to check
+	/// different contracts concurrently, since the cycle checks depend on the dependencies
+	/// of all contracts checked before. Use addContractDependencies afterwards.
+	void deferContractDependencies(std::vector<ContractDependency>& o_dependencies)
+	{
+		m_deferredDependencies = &o_dependencies;
+	}
+
+	/// Adds @a _dependencies to the contract annotations and checks them for cycles, as if they
+	/// were found while type checking. Errors are inserted into @a _errors at the positions
+	/// they would have been reported at.
+	static void addContractDependencies(
+		std::vector<ContractDependency> const& _dependencies,
+		langutil::ErrorList& _errors
+	);
+
 	/// @returns the type of an expression and asserts that it is present.
 	TypePointer const& type(Expression const& _expression) const;
 	/// @returns the type of the given variable and throws if the type is not present
@@ -140,10 +169,18 @@ private:
 	void endVisit(ElementaryTypeNameExpression const& _expr) override;
 	void endVisit(Literal const& _literal) override;
 
-	bool contractDependenciesAreCyclic(
+	/// Adds a dependency of the current contract and reports @a _cycleError if it is cyclic,
+	/// or defers both if requested.
+	void addContractDependency(
+		ContractDefinition const& _dependency,
+		langutil::SourceLocation const& _location,
+		std::string const& _cycleError
+	);
+
+	static bool contractDependenciesAreCyclic(
 		ContractDefinition const& _contract,
 		std::set<ContractDefinition const*> const& _seenContracts = std::set<ContractDefinition const*>()
-	) const;
+	);
 
 	/// @returns the referenced declaration and throws on error.
 	Declaration const& dereference(Identifier const& _identifier) const;
@@ -167,6 +204,9 @@ private:
 	bool m_insideStruct = false;
 
 	langutil::ErrorReporter& m_errorReporter;
+
+	/// If set, contract dependencies are collected here instead of being added.
+	std::vector<ContractDependency>* m_deferredDependencies = nullptr;
 };
 
 }
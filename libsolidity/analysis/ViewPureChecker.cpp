@@ -123,27 +123,46 @@ private:
 
 bool ViewPureChecker::check()
 {
-	vector<ContractDefinition const*> contracts;
-
-	for (auto const& node: m_ast)
-	{
-		SourceUnit const* source = dynamic_cast<SourceUnit const*>(node.get());
-		solAssert(source, "");
-		contracts += source->filteredNodes<ContractDefinition>(source->nodes());
-	}
+	m_inferredMutability = inferModifierMutability(m_ast);
 
-	// Check modifiers first to infer their state mutability.
-	for (auto const& contract: contracts)
-		for (ModifierDefinition const* mod: contract->functionModifiers())
-			mod->accept(*this);
-
-	for (auto const& contract: contracts)
+	for (auto const& contract: contracts(m_ast))
 		contract->accept(*this);
 
 	return !m_errors;
 }
 
+bool ViewPureChecker::check(ASTNode const& _astRoot)
+{
+	_astRoot.accept(*this);
+	return !m_errors;
+}
 
+ViewPureChecker::ModifierMutabilities ViewPureChecker::inferModifierMutability(
+	vector<shared_ptr<ASTNode>> const& _ast
+)
+{
+	// Modifiers themselves never cause errors, only the functions invoking them.
+	ErrorList errors;
+	ErrorReporter errorReporter(errors);
+	ViewPureChecker checker(_ast, errorReporter);
+	for (auto const& contract: contracts(_ast))
+		for (ModifierDefinition const* mod: contract->functionModifiers())
+			mod->accept(checker);
+	solAssert(errors.empty(), "");
+	return std::move(checker.m_inferredMutability);
+}
+
+vector<ContractDefinition const*> ViewPureChecker::contracts(vector<shared_ptr<ASTNode>> const& _ast)
+{
+	vector<ContractDefinition const*> contracts;
+	for (auto const& node: _ast)
+	{
+		SourceUnit const* source = dynamic_cast<SourceUnit const*>(node.get());
+		solAssert(source, "");
+		contracts += source->filteredNodes<ContractDefinition>(source->nodes());
+	}
+	return contracts;
+}
 
 bool ViewPureChecker::visit(FunctionDefinition const& _funDef)
 {
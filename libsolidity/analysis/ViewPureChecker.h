@@ -35,20 +35,33 @@ namespace dev
 namespace solidity
 {
 
-class ViewPureChecker: private ASTConstVisitor
+class ViewPureChecker: public ASTConstVisitor
 {
 public:
+	struct MutabilityAndLocation
+	{
+		StateMutability mutability;
+		langutil::SourceLocation location;
+	};
+	using ModifierMutabilities = std::map<ModifierDefinition const*, MutabilityAndLocation>;
+
 	ViewPureChecker(std::vector<std::shared_ptr<ASTNode>> const& _ast, langutil::ErrorReporter& _errorReporter):
 		m_ast(_ast), m_errorReporter(_errorReporter) {}
+	/// Creates a checker that can be applied to individual source units, given the state
+	/// mutability of all modifiers they might invoke, as returned by inferModifierMutability.
+	ViewPureChecker(ModifierMutabilities _modifierMutabilities, langutil::ErrorReporter& _errorReporter):
+		m_errorReporter(_errorReporter), m_inferredMutability(std::move(_modifierMutabilities)) {}
 
+	/// Checks all contracts of the AST passed to the constructor.
 	bool check();
+	/// Checks all functions inside @a _astRoot.
+	bool check(ASTNode const& _astRoot);
+
+	/// @returns the inferred state mutability of all modifiers of all contracts in @a _ast.
+	static ModifierMutabilities inferModifierMutability(std::vector<std::shared_ptr<ASTNode>> const& _ast);
 
 private:
-	struct MutabilityAndLocation
-	{
-		StateMutability mutability;
-		langutil::SourceLocation location;
-	};
+	static std::vector<ContractDefinition const*> contracts(std::vector<std::shared_ptr<ASTNode>> const& _ast);
 
 	bool visit(FunctionDefinition const& _funDef) override;
 	void endVisit(FunctionDefinition const& _funDef) override;
@@ -70,13 +83,13 @@ private:
 		boost::optional<langutil::SourceLocation> const& _nestedLocation = {}
 	);
 
-	std::vector<std::shared_ptr<ASTNode>> const& m_ast;
+	std::vector<std::shared_ptr<ASTNode>> m_ast;
 	langutil::ErrorReporter& m_errorReporter;
 
 	bool m_errors = false;
 	MutabilityAndLocation m_bestMutabilityAndLocation = MutabilityAndLocation{StateMutability::Payable, langutil::SourceLocation()};
 	FunctionDefinition const* m_currentFunction = nullptr;
-	std::map<ModifierDefinition const*, MutabilityAndLocation> m_inferredMutability;
+	ModifierMutabilities m_inferredMutability;
 };
 
 }
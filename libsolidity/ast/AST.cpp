@@ -155,10 +155,10 @@ FunctionDefinition const* ContractDefinition::fallbackFunction() const
 
 vector<EventDefinition const*> const& ContractDefinition::interfaceEvents() const
 {
-	if (!m_interfaceEvents)
+	return m_interfaceEvents.get([&]()
 	{
 		set<string> eventsSeen;
-		m_interfaceEvents.reset(new vector<EventDefinition const*>());
+		vector<EventDefinition const*> interfaceEvents;
 		for (ContractDefinition const* contract: annotation().linearizedBaseContracts)
 			for (EventDefinition const* e: contract->events())
 			{
@@ -171,19 +171,19 @@ vector<EventDefinition const*> const& ContractDefinition::interfaceEvents() cons
 				if (eventsSeen.count(eventSignature) == 0)
 				{
 					eventsSeen.insert(eventSignature);
-					m_interfaceEvents->push_back(e);
+					interfaceEvents.push_back(e);
 				}
 			}
-	}
-	return *m_interfaceEvents;
+		return interfaceEvents;
+	});
 }
 
 vector<pair<FixedHash<4>, FunctionTypePointer>> const& ContractDefinition::interfaceFunctionList() const
 {
-	if (!m_interfaceFunctionList)
+	return m_interfaceFunctionList.get([&]()
 	{
 		set<string> signaturesSeen;
-		m_interfaceFunctionList.reset(new vector<pair<FixedHash<4>, FunctionTypePointer>>());
+		vector<pair<FixedHash<4>, FunctionTypePointer>> interfaceFunctionList;
 		for (ContractDefinition const* contract: annotation().linearizedBaseContracts)
 		{
 			vector<FunctionTypePointer> functions;
@@ -203,27 +203,27 @@ vector<pair<FixedHash<4>, FunctionTypePointer>> const& ContractDefinition::inter
 				{
 					signaturesSeen.insert(functionSignature);
 					FixedHash<4> hash(dev::keccak256(functionSignature));
-					m_interfaceFunctionList->emplace_back(hash, fun);
+					interfaceFunctionList.emplace_back(hash, fun);
 				}
 			}
 		}
-	}
-	return *m_interfaceFunctionList;
+		return interfaceFunctionList;
+	});
 }
 
 vector<Declaration const*> const& ContractDefinition::inheritableMembers() const
 {
-	if (!m_inheritableMembers)
+	return m_inheritableMembers.get([&]()
 	{
 		set<string> memberSeen;
-		m_inheritableMembers.reset(new vector<Declaration const*>());
+		vector<Declaration const*> inheritableMembers;
 		auto addInheritableMember = [&](Declaration const* _decl)
 		{
 			solAssert(_decl, "addInheritableMember got a nullpointer.");
 			if (memberSeen.count(_decl->name()) == 0 && _decl->isVisibleInDerivedContracts())
 			{
 				memberSeen.insert(_decl->name());
-				m_inheritableMembers->push_back(_decl);
+				inheritableMembers.push_back(_decl);
 			}
 		};
 
@@ -241,8 +241,9 @@ vector<Declaration const*> const& ContractDefinition::inheritableMembers() const
 
 		for (EventDefinition const* e: events())
 			addInheritableMember(e);
-	}
-	return *m_inheritableMembers;
+
+		return inheritableMembers;
+	});
 }
 
 TypePointer ContractDefinition::type() const
@@ -0,0 +1,462 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Converts the AST into a compact binary format and back into the JSON format.
+ */
+
+#include <libsolidity/ast/ASTBinaryConverter.h>
+
+#include <libsolidity/ast/ASTJsonConverter.h>
+
+#include <libdevcore/CommonData.h>
+
+#include <boost/algorithm/string/classification.hpp>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/optional.hpp>
+
+#include <array>
+#include <cstring>
+#include <unordered_map>
+
+using namespace std;
+using namespace dev;
+using namespace dev::solidity;
+
+namespace
+{
+
+enum class Tag: uint8_t
+{
+	Null,
+	False,
+	True,
+	Int,
+	UInt,
+	Real,
+	String,
+	Array,
+	Object,
+	Node
+};
+
+bytes const c_magic{'s', 'A', 'S', 'T'};
+
+/// Source location of a node, as start, length and source index.
+using SourceLocationParts = array<int64_t, 3>;
+
+string formatSourceLocation(SourceLocationParts const& _parts)
+{
+	return to_string(_parts[0]) + ":" + to_string(_parts[1]) + ":" + to_string(_parts[2]);
+}
+
+/// Parses a source location in the format produced by ASTJsonConverter.
+/// @returns false if @a _location is not in that format, such that formatting the parts
+/// would not reproduce it.
+bool parseSourceLocation(string const& _location, SourceLocationParts& _parts)
+{
+	vector<string> parts;
+	boost::split(parts, _location, boost::is_any_of(":"));
+	if (parts.size() != _parts.size())
+		return false;
+	for (size_t i = 0; i < parts.size(); ++i)
+		try
+		{
+			size_t end = 0;
+			_parts[i] = stoll(parts[i], &end);
+			if (end != parts[i].size())
+				return false;
+		}
+		catch (invalid_argument const&)
+		{
+			return false;
+		}
+		catch (out_of_range const&)
+		{
+			return false;
+		}
+	return formatSourceLocation(_parts) == _location;
+}
+
+/// Key of the single member of the objects that stand for values encoded before.
+/// Keys in the JSON AST are names of attributes or identifiers, which never contain spaces.
+string const c_encodedValueKey = " encodedValue";
+
+/**
+ * Encoder of JSON values into the binary format.
+ * Values can be encoded piecewise: encodePart() encodes a value and returns a placeholder,
+ * which can be used in values encoded later to refer to the encoding of the part.
+ */
+class Encoder
+{
+public:
+	/// Encodes @a _value, which can contain placeholders returned earlier, and
+	/// @returns a placeholder for it.
+	Json::Value encodePart(Json::Value const& _value)
+	{
+		m_parts.emplace_back();
+		appendValue(_value);
+		Json::Value placeholder(Json::objectValue);
+		placeholder[c_encodedValueKey] = Json::UInt64(m_parts.size() - 1);
+		return placeholder;
+	}
+
+	/// @returns the complete encoding of @a _value, which can contain placeholders.
+	bytes encode(Json::Value const& _value)
+	{
+		encodePart(_value);
+
+		bytes result = c_magic;
+		appendUnsigned(result, ASTBinaryConverter::c_formatVersion);
+		appendUnsigned(result, m_strings.size());
+		for (string const* str: m_strings)
+		{
+			appendUnsigned(result, str->size());
+			result += asBytes(*str);
+		}
+		appendPart(result, m_parts.size() - 1);
+		return result;
+	}
+
+private:
+	/// Encoding of a value, where the encodings of other parts still have to be inserted.
+	struct Part
+	{
+		bytes data;
+		/// Pairs of position in data and index of the part to be inserted there, in increasing order.
+		vector<pair<size_t, size_t>> insertions;
+	};
+
+	void appendPart(bytes& _out, size_t _index) const
+	{
+		Part const& part = m_parts[_index];
+		size_t position = 0;
+		for (auto const& insertion: part.insertions)
+		{
+			_out.insert(_out.end(), part.data.begin() + position, part.data.begin() + insertion.first);
+			appendPart(_out, insertion.second);
+			position = insertion.first;
+		}
+		_out.insert(_out.end(), part.data.begin() + position, part.data.end());
+	}
+
+	bytes& body() { return m_parts.back().data; }
+
+	/// @returns the index of the part @a _object is a placeholder for, if it is one.
+	/// Only parts encoded before the current one can be referred to, so encoding
+	/// arbitrary JSON values in a single part is never affected.
+	boost::optional<size_t> placeholderIndex(Json::Value const& _object) const
+	{
+		if (_object.size() != 1 || !_object.isMember(c_encodedValueKey))
+			return {};
+		Json::Value const& index = _object[c_encodedValueKey];
+		if (!index.isUInt64() || index.asUInt64() + 1 >= m_parts.size())
+			return {};
+		return size_t(index.asUInt64());
+	}
+
+	static void appendUnsigned(bytes& _out, uint64_t _value)
+	{
+		for (; _value >= 0x80; _value >>= 7)
+			_out.push_back(uint8_t(_value | 0x80));
+		_out.push_back(uint8_t(_value));
+	}
+	void appendUnsigned(uint64_t _value) { appendUnsigned(body(), _value); }
+	void appendSigned(int64_t _value)
+	{
+		appendUnsigned((uint64_t(_value) << 1) ^ uint64_t(_value >> 63));
+	}
+	void appendTag(Tag _tag) { body().push_back(uint8_t(_tag)); }
+	void appendString(string const& _str)
+	{
+		auto inserted = m_stringIndices.emplace(_str, m_strings.size());
+		if (inserted.second)
+			m_strings.push_back(&inserted.first->first);
+		appendUnsigned(inserted.first->second);
+	}
+
+	void appendValue(Json::Value const& _value)
+	{
+		switch (_value.type())
+		{
+		case Json::nullValue:
+			appendTag(Tag::Null);
+			break;
+		case Json::booleanValue:
+			appendTag(_value.asBool() ? Tag::True : Tag::False);
+			break;
+		case Json::intValue:
+			appendTag(Tag::Int);
+			appendSigned(_value.asInt64());
+			break;
+		case Json::uintValue:
+			appendTag(Tag::UInt);
+			appendUnsigned(_value.asUInt64());
+			break;
+		case Json::realValue:
+		{
+			appendTag(Tag::Real);
+			double value = _value.asDouble();
+			uint64_t bits;
+			memcpy(&bits, &value, sizeof(bits));
+			for (int shift = 56; shift >= 0; shift -= 8)
+				body().push_back(uint8_t(bits >> shift));
+			break;
+		}
+		case Json::stringValue:
+			appendTag(Tag::String);
+			appendString(_value.asString());
+			break;
+		case Json::arrayValue:
+			appendTag(Tag::Array);
+			appendUnsigned(_value.size());
+			for (auto const& element: _value)
+				appendValue(element);
+			break;
+		case Json::objectValue:
+			if (auto index = placeholderIndex(_value))
+				m_parts.back().insertions.emplace_back(body().size(), *index);
+			else if (!appendNode(_value))
+			{
+				appendTag(Tag::Object);
+				appendMembers(_value, {});
+			}
+			break;
+		}
+	}
+
+	/// Appends @a _object as an AST node if it has the members of one.
+	/// @returns false if it does not.
+	bool appendNode(Json::Value const& _object)
+	{
+		Json::Value const& nodeType = _object["nodeType"];
+		Json::Value const& id = _object["id"];
+		Json::Value const& src = _object["src"];
+		SourceLocationParts location;
+		if (
+			!nodeType.isString() ||
+			id.type() != Json::intValue ||
+			!src.isString() ||
+			!parseSourceLocation(src.asString(), location)
+		)
+			return false;
+
+		appendTag(Tag::Node);
+		appendString(nodeType.asString());
+		appendSigned(id.asInt64());
+		for (int64_t part: location)
+			appendSigned(part);
+		appendMembers(_object, {"nodeType", "id", "src"});
+		return true;
+	}
+
+	void appendMembers(Json::Value const& _object, vector<string> const& _skippedMembers)
+	{
+		appendUnsigned(_object.size() - _skippedMembers.size());
+		for (auto it = _object.begin(); it != _object.end(); ++it)
+		{
+			string const name = it.name();
+			if (contains(_skippedMembers, name))
+				continue;
+			appendString(name);
+			appendValue(*it);
+		}
+	}
+
+	vector<Part> m_parts;
+	unordered_map<string, size_t> m_stringIndices;
+	vector<string const*> m_strings;
+};
+
+class Decoder
+{
+public:
+	explicit Decoder(bytes const& _data): m_data(_data) {}
+
+	Json::Value decode()
+	{
+		for (uint8_t byte: c_magic)
+			require(readByte() == byte);
+		require(readUnsigned() == ASTBinaryConverter::c_formatVersion);
+
+		uint64_t stringCount = readCount();
+		for (uint64_t i = 0; i < stringCount; ++i)
+		{
+			uint64_t length = readUnsigned();
+			require(length <= m_data.size() - m_position);
+			m_strings.emplace_back(m_data.begin() + m_position, m_data.begin() + m_position + length);
+			m_position += length;
+		}
+
+		Json::Value result = readValue();
+		require(m_position == m_data.size());
+		return result;
+	}
+
+private:
+	static void require(bool _condition)
+	{
+		if (!_condition)
+			BOOST_THROW_EXCEPTION(InvalidBinaryAST());
+	}
+
+	uint8_t readByte()
+	{
+		require(m_position < m_data.size());
+		return m_data[m_position++];
+	}
+	uint64_t readUnsigned()
+	{
+		uint64_t value = 0;
+		for (unsigned shift = 0; ; shift += 7)
+		{
+			require(shift < 64);
+			uint8_t byte = readByte();
+			value |= uint64_t(byte & 0x7f) << shift;
+			if (!(byte & 0x80))
+				return value;
+		}
+	}
+	int64_t readSigned()
+	{
+		uint64_t value = readUnsigned();
+		return int64_t(value >> 1) ^ -int64_t(value & 1);
+	}
+	/// Reads a number of elements, each of which takes at least one more byte.
+	uint64_t readCount()
+	{
+		uint64_t count = readUnsigned();
+		require(count <= m_data.size() - m_position);
+		return count;
+	}
+	string const& readString()
+	{
+		uint64_t index = readUnsigned();
+		require(index < m_strings.size());
+		return m_strings[index];
+	}
+
+	Json::Value readValue()
+	{
+		switch (Tag(readByte()))
+		{
+		case Tag::Null:
+			return Json::nullValue;
+		case Tag::False:
+			return false;
+		case Tag::True:
+			return true;
+		case Tag::Int:
+			return Json::Int64(readSigned());
+		case Tag::UInt:
+			return Json::UInt64(readUnsigned());
+		case Tag::Real:
+		{
+			uint64_t bits = 0;
+			for (size_t i = 0; i < 8; ++i)
+				bits = (bits << 8) | readByte();
+			double value;
+			memcpy(&value, &bits, sizeof(value));
+			return value;
+		}
+		case Tag::String:
+			return readString();
+		case Tag::Array:
+		{
+			Json::Value array(Json::arrayValue);
+			for (uint64_t count = readCount(); count > 0; --count)
+				array.append(readValue());
+			return array;
+		}
+		case Tag::Object:
+		{
+			Json::Value object(Json::objectValue);
+			readMembers(object);
+			return object;
+		}
+		case Tag::Node:
+		{
+			Json::Value node(Json::objectValue);
+			node["nodeType"] = readString();
+			node["id"] = Json::Int64(readSigned());
+			SourceLocationParts location;
+			for (int64_t& part: location)
+				part = readSigned();
+			node["src"] = formatSourceLocation(location);
+			readMembers(node);
+			return node;
+		}
+		}
+		require(false);
+		return Json::nullValue;
+	}
+
+	void readMembers(Json::Value& _object)
+	{
+		for (uint64_t count = readCount(); count > 0; --count)
+		{
+			string const& name = readString();
+			require(!_object.isMember(name));
+			_object[name] = readValue();
+		}
+	}
+
+	bytes const& m_data;
+	size_t m_position = 0;
+	vector<string> m_strings;
+};
+
+/**
+ * Converter of the AST into the JSON format that encodes every node as soon as its JSON value
+ * is complete. The parents only receive placeholders, so the JSON value of the whole AST is
+ * never built or copied.
+ */
+class NodeEncoder: public ASTJsonConverter
+{
+public:
+	NodeEncoder(Encoder& _encoder, map<string, unsigned> const& _sourceIndices):
+		ASTJsonConverter(false, _sourceIndices),
+		m_encoder(_encoder)
+	{}
+
+protected:
+	void nodeConverted(Json::Value& _node) override
+	{
+		_node = m_encoder.encodePart(_node);
+	}
+
+private:
+	Encoder& m_encoder;
+};
+
+}
+
+bytes ASTBinaryConverter::toBinary(ASTNode const& _node) const
+{
+	Encoder encoder;
+	Json::Value root = NodeEncoder(encoder, m_sourceIndices).toJson(_node);
+	return encoder.encode(root);
+}
+
+bytes ASTBinaryConverter::encode(Json::Value const& _value)
+{
+	return Encoder().encode(_value);
+}
+
+Json::Value ASTBinaryConverter::decode(bytes const& _data)
+{
+	return Decoder(_data).decode();
+}
@@ -0,0 +1,83 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Converts the AST into a compact binary format and back into the JSON format.
+ */
+
+#pragma once
+
+#include <libsolidity/ast/ASTForward.h>
+
+#include <libdevcore/Common.h>
+#include <libdevcore/Exceptions.h>
+
+#include <json/json.h>
+
+#include <map>
+#include <string>
+
+namespace dev
+{
+namespace solidity
+{
+
+DEV_SIMPLE_EXCEPTION(InvalidBinaryAST);
+
+/**
+ * Converter of the AST into a binary encoding of its compact JSON format, and reference decoder.
+ *
+ * Format (version 1), all integers are unsigned LEB128 varints unless noted otherwise:
+ *   "sAST" version stringCount (length bytes)* value
+ * where a value starts with a tag byte:
+ *   0: null, 1: false, 2: true,
+ *   3: signed integer (zigzag varint), 4: unsigned integer (varint),
+ *   5: real (IEEE 754 double, 8 bytes big endian),
+ *   6: string (index into the string table),
+ *   7: array (count value*),
+ *   8: object (count (key-index value)*),
+ *   9: AST node (nodeType-index id start length sourceIndex count (key-index value)*),
+ *      where id, start, length and sourceIndex are zigzag varints and the remaining members
+ *      are encoded as for objects.
+ * Decoding yields exactly the JSON value that was encoded.
+ */
+class ASTBinaryConverter
+{
+public:
+	static unsigned constexpr c_formatVersion = 1;
+
+	/// Create a binary converter for the given abstract syntax tree.
+	/// @a _sourceIndices is used to abbreviate source names in source locations.
+	explicit ASTBinaryConverter(std::map<std::string, unsigned> _sourceIndices = std::map<std::string, unsigned>()):
+		m_sourceIndices(std::move(_sourceIndices))
+	{}
+
+	/// @returns the binary encoding of the compact JSON AST of @a _node.
+	/// The nodes are encoded one by one, without building the JSON AST.
+	bytes toBinary(ASTNode const& _node) const;
+
+	/// @returns the binary encoding of an arbitrary JSON value.
+	static bytes encode(Json::Value const& _value);
+	/// @returns the JSON value encoded in @a _data.
+	/// @throws InvalidBinaryAST if @a _data is not a valid encoding.
+	static Json::Value decode(bytes const& _data);
+
+private:
+	std::map<std::string, unsigned> m_sourceIndices;
+};
+
+}
+}
@@ -118,6 +118,7 @@ void ASTJsonConverter::setJsonNode(
 		if (!attrs.empty())
 			m_currentValue["attributes"] = std::move(attrs);
 	}
+	nodeConverted(m_currentValue);
 }
 
 string ASTJsonConverter::sourceLocationToString(SourceLocation const& _location) const
@@ -115,6 +115,11 @@ public:
 
 	void endVisit(EventDefinition const&) override;
 
+protected:
+	/// Called with the JSON value of every node once it is complete. The value is
+	/// then used for the node in the JSON value of its parent. Does nothing by default.
+	virtual void nodeConverted(Json::Value& /*_node*/) {}
+
 private:
 	void setJsonNode(
 		ASTNode const& _node,
@@ -270,6 +270,153 @@ private:
 	std::function<void(ASTNode const&)> m_onEndVisit;
 };
 
+/**
+ * Visitor that runs several independent visitors in a single traversal of the AST.
+ * For each node, the visitors are called in the order they were added. If the visit function of
+ * a visitor returns false, the children of that node are skipped for this visitor only, but its
+ * endVisit function is still called for the node itself. The traversal only stops descending
+ * once all visitors stopped descending.
+ */
+class CompositeASTConstVisitor: public ASTConstVisitor
+{
+public:
+	explicit CompositeASTConstVisitor(std::vector<ASTConstVisitor*> _visitors = {})
+	{
+		for (ASTConstVisitor* visitor: _visitors)
+			add(*visitor);
+	}
+
+	void add(ASTConstVisitor& _visitor) { m_visitors.push_back({&_visitor, nullptr}); }
+
+	bool visit(SourceUnit const& _node) override { return visitAll(_node); }
+	bool visit(PragmaDirective const& _node) override { return visitAll(_node); }
+	bool visit(ImportDirective const& _node) override { return visitAll(_node); }
+	bool visit(ContractDefinition const& _node) override { return visitAll(_node); }
+	bool visit(InheritanceSpecifier const& _node) override { return visitAll(_node); }
+	bool visit(StructDefinition const& _node) override { return visitAll(_node); }
+	bool visit(UsingForDirective const& _node) override { return visitAll(_node); }
+	bool visit(EnumDefinition const& _node) override { return visitAll(_node); }
+	bool visit(EnumValue const& _node) override { return visitAll(_node); }
+	bool visit(ParameterList const& _node) override { return visitAll(_node); }
+	bool visit(FunctionDefinition const& _node) override { return visitAll(_node); }
+	bool visit(VariableDeclaration const& _node) override { return visitAll(_node); }
+	bool visit(ModifierDefinition const& _node) override { return visitAll(_node); }
+	bool visit(ModifierInvocation const& _node) override { return visitAll(_node); }
+	bool visit(EventDefinition const& _node) override { return visitAll(_node); }
+	bool visit(ElementaryTypeName const& _node) override { return visitAll(_node); }
+	bool visit(UserDefinedTypeName const& _node) override { return visitAll(_node); }
+	bool visit(FunctionTypeName const& _node) override { return visitAll(_node); }
+	bool visit(Mapping const& _node) override { return visitAll(_node); }
+	bool visit(ArrayTypeName const& _node) override { return visitAll(_node); }
+	bool visit(Block const& _node) override { return visitAll(_node); }
+	bool visit(PlaceholderStatement const& _node) override { return visitAll(_node); }
+	bool visit(IfStatement const& _node) override { return visitAll(_node); }
+	bool visit(WhileStatement const& _node) override { return visitAll(_node); }
+	bool visit(ForStatement const& _node) override { return visitAll(_node); }
+	bool visit(Continue const& _node) override { return visitAll(_node); }
+	bool visit(InlineAssembly const& _node) override { return visitAll(_node); }
+	bool visit(Break const& _node) override { return visitAll(_node); }
+	bool visit(Return const& _node) override { return visitAll(_node); }
+	bool visit(Throw const& _node) override { return visitAll(_node); }
+	bool visit(EmitStatement const& _node) override { return visitAll(_node); }
+	bool visit(VariableDeclarationStatement const& _node) override { return visitAll(_node); }
+	bool visit(ExpressionStatement const& _node) override { return visitAll(_node); }
+	bool visit(Conditional const& _node) override { return visitAll(_node); }
+	bool visit(Assignment const& _node) override { return visitAll(_node); }
+	bool visit(TupleExpression const& _node) override { return visitAll(_node); }
+	bool visit(UnaryOperation const& _node) override { return visitAll(_node); }
+	bool visit(BinaryOperation const& _node) override { return visitAll(_node); }
+	bool visit(FunctionCall const& _node) override { return visitAll(_node); }
+	bool visit(NewExpression const& _node) override { return visitAll(_node); }
+	bool visit(MemberAccess const& _node) override { return visitAll(_node); }
+	bool visit(IndexAccess const& _node) override { return visitAll(_node); }
+	bool visit(Identifier const& _node) override { return visitAll(_node); }
+	bool visit(ElementaryTypeNameExpression const& _node) override { return visitAll(_node); }
+	bool visit(Literal const& _node) override { return visitAll(_node); }
+
+	void endVisit(SourceUnit const& _node) override { endVisitAll(_node); }
+	void endVisit(PragmaDirective const& _node) override { endVisitAll(_node); }
+	void endVisit(ImportDirective const& _node) override { endVisitAll(_node); }
+	void endVisit(ContractDefinition const& _node) override { endVisitAll(_node); }
+	void endVisit(InheritanceSpecifier const& _node) override { endVisitAll(_node); }
+	void endVisit(UsingForDirective const& _node) override { endVisitAll(_node); }
+	void endVisit(StructDefinition const& _node) override { endVisitAll(_node); }
+	void endVisit(EnumDefinition const& _node) override { endVisitAll(_node); }
+	void endVisit(EnumValue const& _node) override { endVisitAll(_node); }
+	void endVisit(ParameterList const& _node) override { endVisitAll(_node); }
+	void endVisit(FunctionDefinition const& _node) override { endVisitAll(_node); }
+	void endVisit(VariableDeclaration const& _node) override { endVisitAll(_node); }
+	void endVisit(ModifierDefinition const& _node) override { endVisitAll(_node); }
+	void endVisit(ModifierInvocation const& _node) override { endVisitAll(_node); }
+	void endVisit(EventDefinition const& _node) override { endVisitAll(_node); }
+	void endVisit(ElementaryTypeName const& _node) override { endVisitAll(_node); }
+	void endVisit(UserDefinedTypeName const& _node) override { endVisitAll(_node); }
+	void endVisit(FunctionTypeName const& _node) override { endVisitAll(_node); }
+	void endVisit(Mapping const& _node) override { endVisitAll(_node); }
+	void endVisit(ArrayTypeName const& _node) override { endVisitAll(_node); }
+	void endVisit(Block const& _node) override { endVisitAll(_node); }
+	void endVisit(PlaceholderStatement const& _node) override { endVisitAll(_node); }
+	void endVisit(IfStatement const& _node) override { endVisitAll(_node); }
+	void endVisit(WhileStatement const& _node) override { endVisitAll(_node); }
+	void endVisit(ForStatement const& _node) override { endVisitAll(_node); }
+	void endVisit(Continue const& _node) override { endVisitAll(_node); }
+	void endVisit(InlineAssembly const& _node) override { endVisitAll(_node); }
+	void endVisit(Break const& _node) override { endVisitAll(_node); }
+	void endVisit(Return const& _node) override { endVisitAll(_node); }
+	void endVisit(Throw const& _node) override { endVisitAll(_node); }
+	void endVisit(EmitStatement const& _node) override { endVisitAll(_node); }
+	void endVisit(VariableDeclarationStatement const& _node) override { endVisitAll(_node); }
+	void endVisit(ExpressionStatement const& _node) override { endVisitAll(_node); }
+	void endVisit(Conditional const& _node) override { endVisitAll(_node); }
+	void endVisit(Assignment const& _node) override { endVisitAll(_node); }
+	void endVisit(TupleExpression const& _node) override { endVisitAll(_node); }
+	void endVisit(UnaryOperation const& _node) override { endVisitAll(_node); }
+	void endVisit(BinaryOperation const& _node) override { endVisitAll(_node); }
+	void endVisit(FunctionCall const& _node) override { endVisitAll(_node); }
+	void endVisit(NewExpression const& _node) override { endVisitAll(_node); }
+	void endVisit(MemberAccess const& _node) override { endVisitAll(_node); }
+	void endVisit(IndexAccess const& _node) override { endVisitAll(_node); }
+	void endVisit(Identifier const& _node) override { endVisitAll(_node); }
+	void endVisit(ElementaryTypeNameExpression const& _node) override { endVisitAll(_node); }
+	void endVisit(Literal const& _node) override { endVisitAll(_node); }
+
+private:
+	struct Entry
+	{
+		ASTConstVisitor* visitor;
+		/// Node whose children are skipped for this visitor, nullptr if the visitor is active.
+		ASTNode const* skipped;
+	};
+
+	template <class NodeType>
+	bool visitAll(NodeType const& _node)
+	{
+		bool descend = false;
+		for (Entry& entry: m_visitors)
+			if (!entry.skipped)
+			{
+				if (entry.visitor->visit(_node))
+					descend = true;
+				else
+					entry.skipped = &_node;
+			}
+		return descend;
+	}
+
+	template <class NodeType>
+	void endVisitAll(NodeType const& _node)
+	{
+		for (Entry& entry: m_visitors)
+			if (!entry.skipped || entry.skipped == &_node)
+			{
+				entry.skipped = nullptr;
+				entry.visitor->endVisit(_node);
+			}
+	}
+
+	std::vector<Entry> m_visitors;
+};
+
 /**
  * Utility class that visits the AST in depth-first order and calls a function on each node and each edge.
  * Child nodes are only visited if the node callback of the parent returns true.
@@ -20,10 +20,16 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/split.hpp>
 
+#include <functional>
+#include <thread>
+
 using namespace std;
 using namespace dev;
 using namespace solidity;
 
+mutex TypeProvider::m_mutex;
+array<mutex, TypeProvider::c_shardCount> TypeProvider::m_shardMutexes;
+
 BoolType const TypeProvider::m_boolean{};
 InaccessibleDynamicType const TypeProvider::m_inaccessibleDynamic{};
 
@@ -173,6 +179,7 @@ inline void clearCaches(Container& container)
 
 void TypeProvider::reset()
 {
+	lock_guard<mutex> lock(m_mutex);
 	clearCache(m_boolean);
 	clearCache(m_inaccessibleDynamic);
 	clearCache(m_bytesStorage);
@@ -187,8 +194,12 @@ void TypeProvider::reset()
 	clearCaches(instance().m_bytesM);
 	clearCaches(instance().m_magics);
 
-	instance().m_generalTypes.clear();
-	instance().m_stringLiteralTypes.clear();
+	for (size_t shard = 0; shard < c_shardCount; ++shard)
+	{
+		lock_guard<mutex> shardLock(m_shardMutexes[shard]);
+		instance().m_generalTypes[shard].clear();
+		instance().m_stringLiteralTypes[shard].clear();
+	}
 	instance().m_ufixedMxN.clear();
 	instance().m_fixedMxN.clear();
 }
@@ -196,8 +207,20 @@ void TypeProvider::reset()
 template <typename T, typename... Args>
 inline T const* TypeProvider::createAndGet(Args&& ... _args)
 {
-	instance().m_generalTypes.emplace_back(make_unique<T>(std::forward<Args>(_args)...));
-	return static_cast<T const*>(instance().m_generalTypes.back().get());
+	return static_cast<T const*>(store(make_unique<T>(std::forward<Args>(_args)...)));
+}
+
+Type const* TypeProvider::store(unique_ptr<Type> _type)
+{
+	size_t shard = currentThreadShard();
+	lock_guard<mutex> lock(m_shardMutexes[shard]);
+	instance().m_generalTypes[shard].emplace_back(move(_type));
+	return instance().m_generalTypes[shard].back().get();
+}
+
+size_t TypeProvider::currentThreadShard()
+{
+	return hash<thread::id>()(this_thread::get_id()) % c_shardCount;
 }
 
 Type const* TypeProvider::fromElementaryTypeName(ElementaryTypeNameToken const& _type)
@@ -295,6 +318,7 @@ TypePointer TypeProvider::fromElementaryTypeName(string const& _name)
 
 ArrayType const* TypeProvider::bytesStorage()
 {
+	lock_guard<mutex> lock(m_mutex);
 	if (!m_bytesStorage)
 		m_bytesStorage = make_unique<ArrayType>(DataLocation::Storage, false);
 	return m_bytesStorage.get();
@@ -302,6 +326,7 @@ ArrayType const* TypeProvider::bytesStorage()
 
 ArrayType const* TypeProvider::bytesMemory()
 {
+	lock_guard<mutex> lock(m_mutex);
 	if (!m_bytesMemory)
 		m_bytesMemory = make_unique<ArrayType>(DataLocation::Memory, false);
 	return m_bytesMemory.get();
@@ -309,6 +334,7 @@ ArrayType const* TypeProvider::bytesMemory()
 
 ArrayType const* TypeProvider::stringStorage()
 {
+	lock_guard<mutex> lock(m_mutex);
 	if (!m_stringStorage)
 		m_stringStorage = make_unique<ArrayType>(DataLocation::Storage, true);
 	return m_stringStorage.get();
@@ -316,6 +342,7 @@ ArrayType const* TypeProvider::stringStorage()
 
 ArrayType const* TypeProvider::stringMemory()
 {
+	lock_guard<mutex> lock(m_mutex);
 	if (!m_stringMemory)
 		m_stringMemory = make_unique<ArrayType>(DataLocation::Memory, true);
 	return m_stringMemory.get();
@@ -358,15 +385,19 @@ RationalNumberType const* TypeProvider::rationalNumber(Literal const& _literal)
 
 StringLiteralType const* TypeProvider::stringLiteral(string const& literal)
 {
-	auto i = instance().m_stringLiteralTypes.find(literal);
-	if (i != instance().m_stringLiteralTypes.end())
+	size_t shard = hash<string>()(literal) % c_shardCount;
+	lock_guard<mutex> lock(m_shardMutexes[shard]);
+	auto& literals = instance().m_stringLiteralTypes[shard];
+	auto i = literals.find(literal);
+	if (i != literals.end())
 		return i->second.get();
 	else
-		return instance().m_stringLiteralTypes.emplace(literal, make_unique<StringLiteralType>(literal)).first->second.get();
+		return literals.emplace(literal, make_unique<StringLiteralType>(literal)).first->second.get();
 }
 
 FixedPointType const* TypeProvider::fixedPoint(unsigned m, unsigned n, FixedPointType::Modifier _modifier)
 {
+	lock_guard<mutex> lock(m_mutex);
 	auto& map = _modifier == FixedPointType::Modifier::Unsigned ? instance().m_ufixedMxN : instance().m_fixedMxN;
 
 	auto i = map.find(make_pair(m, n));
@@ -392,8 +423,7 @@ ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, Data
 	if (_type->location() == _location && _type->isPointer() == _isPointer)
 		return _type;
 
-	instance().m_generalTypes.emplace_back(_type->copyForLocation(_location, _isPointer));
-	return static_cast<ReferenceType const*>(instance().m_generalTypes.back().get());
+	return static_cast<ReferenceType const*>(store(_type->copyForLocation(_location, _isPointer)));
 }
 
 FunctionType const* TypeProvider::function(FunctionDefinition const& _function, bool _isInternal)
@@ -22,6 +22,7 @@
 #include <array>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <utility>
 
 namespace dev
@@ -37,6 +38,11 @@ namespace solidity
  *
  * It is not recommended to explicitly instantiate types unless you really know what and why
  * you are doing it.
+ *
+ * Requesting types is thread-safe and cheap to do concurrently, since types are stored in
+ * separately locked shards. Lazily computed properties of types can be queried concurrently
+ * as well, they are published atomically without locking (see LazyInit).
+ * Resetting the provider must not overlap with any other use.
  */
 class TypeProvider
 {
@@ -197,6 +203,19 @@ private:
 	template <typename T, typename... Args>
 	static inline T const* createAndGet(Args&& ... _args);
 
+	/// Takes ownership of @a _type and @returns a pointer to it.
+	static Type const* store(std::unique_ptr<Type> _type);
+
+	/// Number of shards of the type containers below.
+	static size_t constexpr c_shardCount = 16;
+	/// @returns the shard used for storing types created by the current thread.
+	static size_t currentThreadShard();
+
+	/// Guards the fixed point type containers and the lazy-initialized types.
+	static std::mutex m_mutex;
+	/// Guard the shards of m_generalTypes and m_stringLiteralTypes.
+	static std::array<std::mutex, c_shardCount> m_shardMutexes;
+
 	static BoolType const m_boolean;
 	static InaccessibleDynamicType const m_inaccessibleDynamic;
 
@@ -216,8 +235,11 @@ private:
 
 	std::map<std::pair<unsigned, unsigned>, std::unique_ptr<FixedPointType>> m_ufixedMxN{};
 	std::map<std::pair<unsigned, unsigned>, std::unique_ptr<FixedPointType>> m_fixedMxN{};
-	std::map<std::string, std::unique_ptr<StringLiteralType>> m_stringLiteralTypes{};
-	std::vector<std::unique_ptr<Type>> m_generalTypes{};
+	/// String literal types, sharded by the hash of the literal, so that every literal has
+	/// exactly one type.
+	std::array<std::map<std::string, std::unique_ptr<StringLiteralType>>, c_shardCount> m_stringLiteralTypes{};
+	/// All other types, sharded by the creating thread.
+	std::array<std::vector<std::unique_ptr<Type>>, c_shardCount> m_generalTypes{};
 };
 
 } // namespace solidity
@@ -43,6 +43,7 @@
 #include <boost/range/algorithm/copy.hpp>
 
 #include <limits>
+#include <mutex>
 
 using namespace std;
 using namespace dev;
@@ -126,6 +127,109 @@ bool fitsPrecisionBase2(bigint const& _mantissa, uint32_t _expBase2)
 	return fitsPrecisionBaseX(_mantissa, 1.0, _expBase2);
 }
 
+/// Exclusive bound of the absolute value of integers handled by the small integer fast path
+/// of rational arithmetic. It leaves enough headroom that adding or subtracting two such
+/// values cannot overflow.
+int64_t const c_smallIntegerLimit = int64_t(1) << 62;
+
+/// Evaluates the binary operator @a _operator on the small integers @a _left and @a _right.
+/// @returns the result, or an empty optional if the operation or its result is not handled
+/// by the fast path and has to be evaluated on rationals.
+boost::optional<int64_t> smallIntegerBinaryOperation(Token _operator, int64_t _left, int64_t _right)
+{
+	int64_t result = 0;
+	switch (_operator)
+	{
+	// Bit operations are only done here on non-negative values, so that they do not depend
+	// on the representation of negative values.
+	case Token::BitOr:
+		if (_left < 0 || _right < 0)
+			return {};
+		result = _left | _right;
+		break;
+	case Token::BitXor:
+		if (_left < 0 || _right < 0)
+			return {};
+		result = _left ^ _right;
+		break;
+	case Token::BitAnd:
+		if (_left < 0 || _right < 0)
+			return {};
+		result = _left & _right;
+		break;
+	case Token::Add:
+		result = _left + _right;
+		break;
+	case Token::Sub:
+		result = _left - _right;
+		break;
+	case Token::Mul:
+		if (_left != 0 && abs(_right) > (c_smallIntegerLimit - 1) / abs(_left))
+			return {};
+		result = _left * _right;
+		break;
+	case Token::Div:
+		// Fractional results need a rational.
+		if (_right == 0 || _left % _right != 0)
+			return {};
+		result = _left / _right;
+		break;
+	case Token::Mod:
+		if (_right == 0)
+			return {};
+		result = _left % _right;
+		break;
+	case Token::Exp:
+		if (_right < 0)
+			return {};
+		else if (_right == 0)
+			result = 1;
+		else if (_left == 0 || _left == 1)
+			result = _left;
+		else if (_left == -1)
+			result = (_right & 1) ? -1 : 1;
+		else
+		{
+			// Since the absolute value of the base is at least two, this overflows after
+			// at most 62 iterations.
+			result = 1;
+			for (int64_t i = 0; i < _right; ++i)
+			{
+				if (abs(result) > (c_smallIntegerLimit - 1) / abs(_left))
+					return {};
+				result *= _left;
+			}
+		}
+		break;
+	case Token::SHL:
+		if (_right < 0 || _right > numeric_limits<uint32_t>::max())
+			return {};
+		else if (_left == 0)
+			result = 0;
+		else if (_right >= 62 || abs(_left) >= (c_smallIntegerLimit >> _right))
+			return {};
+		else
+			result = _left * (int64_t(1) << _right);
+		break;
+	case Token::SAR:
+		if (_right < 0 || _right > numeric_limits<uint32_t>::max())
+			return {};
+		else if (_right >= 62)
+			result = _left < 0 ? -1 : 0;
+		else if (_left < 0)
+			// Rounds towards negative infinity, see RationalNumberType::binaryOperatorResult.
+			result = (_left + 1) / (int64_t(1) << _right) - 1;
+		else
+			result = _left / (int64_t(1) << _right);
+		break;
+	default:
+		return {};
+	}
+	if (result <= -c_smallIntegerLimit || result >= c_smallIntegerLimit)
+		return {};
+	return result;
+}
+
 /// Checks whether _value fits into IntegerType _type.
 BoolResult fitsIntegerType(bigint const& _value, IntegerType const& _type)
 {
@@ -168,6 +272,8 @@ Result<TypePointers> transformParametersToExternal(TypePointers const& _paramete
 void Type::clearCache() const
 {
 	m_members.clear();
+	m_richIdentifier.reset();
+	m_identifier.reset();
 }
 
 void StorageOffsets::computeOffsets(TypePointers const& _types)
@@ -221,26 +327,29 @@ void MemberList::combine(MemberList const & _other)
 
 pair<u256, unsigned> const* MemberList::memberStorageOffset(string const& _name) const
 {
-	if (!m_storageOffsets)
-	{
-		TypePointers memberTypes;
-		memberTypes.reserve(m_memberTypes.size());
-		for (auto const& member: m_memberTypes)
-			memberTypes.push_back(member.type);
-		m_storageOffsets.reset(new StorageOffsets());
-		m_storageOffsets->computeOffsets(memberTypes);
-	}
 	for (size_t index = 0; index < m_memberTypes.size(); ++index)
 		if (m_memberTypes[index].name == _name)
-			return m_storageOffsets->offset(index);
+			return storageOffsets().offset(index);
 	return nullptr;
 }
 
 u256 const& MemberList::storageSize() const
 {
-	// trigger lazy computation
-	memberStorageOffset("");
-	return m_storageOffsets->storageSize();
+	return storageOffsets().storageSize();
+}
+
+StorageOffsets const& MemberList::storageOffsets() const
+{
+	return m_storageOffsets.get([&]()
+	{
+		TypePointers memberTypes;
+		memberTypes.reserve(m_memberTypes.size());
+		for (auto const& member: m_memberTypes)
+			memberTypes.push_back(member.type);
+		StorageOffsets offsets;
+		offsets.computeOffsets(memberTypes);
+		return offsets;
+	});
 }
 
 /// Helper functions for type identifier
@@ -299,15 +408,34 @@ string Type::escapeIdentifier(string const& _identifier)
 	return ret;
 }
 
-string Type::identifier() const
+string const& Type::richIdentifier() const
 {
-	string ret = escapeIdentifier(richIdentifier());
-	solAssert(ret.find_first_of("0123456789") != 0, "Identifier cannot start with a number.");
-	solAssert(
-		ret.find_first_not_of("0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMONPQRSTUVWXYZ_$") == string::npos,
-		"Identifier contains invalid characters."
-	);
-	return ret;
+	return m_richIdentifier.get([&]() { return computeRichIdentifier(); });
+}
+
+string const& Type::identifier() const
+{
+	return identifierAndHash().first;
+}
+
+size_t Type::identifierHash() const
+{
+	return identifierAndHash().second;
+}
+
+pair<string, size_t> const& Type::identifierAndHash() const
+{
+	return m_identifier.get([&]()
+	{
+		string ret = escapeIdentifier(richIdentifier());
+		solAssert(ret.find_first_of("0123456789") != 0, "Identifier cannot start with a number.");
+		solAssert(
+			ret.find_first_not_of("0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMONPQRSTUVWXYZ_$") == string::npos,
+			"Identifier contains invalid characters."
+		);
+		size_t identifierHash = hash<string>{}(ret);
+		return make_pair(move(ret), identifierHash);
+	});
 }
 
 TypePointer Type::commonType(Type const* _a, Type const* _b)
@@ -324,14 +452,13 @@ TypePointer Type::commonType(Type const* _a, Type const* _b)
 
 MemberList const& Type::members(ContractDefinition const* _currentScope) const
 {
-	if (!m_members[_currentScope])
+	return m_members.get(_currentScope, [&]()
 	{
 		MemberList::MemberMap members = nativeMembers(_currentScope);
 		if (_currentScope)
 			members += boundFunctions(*this, *_currentScope);
-		m_members[_currentScope] = unique_ptr<MemberList>(new MemberList(move(members)));
-	}
-	return *m_members[_currentScope];
+		return MemberList(move(members));
+	});
 }
 
 TypePointer Type::fullEncodingType(bool _inLibraryCall, bool _encoderV2, bool) const
@@ -393,7 +520,7 @@ AddressType::AddressType(StateMutability _stateMutability):
 	solAssert(m_stateMutability == StateMutability::Payable || m_stateMutability == StateMutability::NonPayable, "");
 }
 
-string AddressType::richIdentifier() const
+string AddressType::computeRichIdentifier() const
 {
 	if (m_stateMutability == StateMutability::Payable)
 		return "t_address_payable";
@@ -505,7 +632,7 @@ IntegerType::IntegerType(unsigned _bits, IntegerType::Modifier _modifier):
 	);
 }
 
-string IntegerType::richIdentifier() const
+string IntegerType::computeRichIdentifier() const
 {
 	return "t_" + string(isSigned() ? "" : "u") + "int" + to_string(numBits());
 }
@@ -631,7 +758,7 @@ FixedPointType::FixedPointType(unsigned _totalBits, unsigned _fractionalDigits,
 	);
 }
 
-string FixedPointType::richIdentifier() const
+string FixedPointType::computeRichIdentifier() const
 {
 	return "t_" + string(isSigned() ? "" : "u") + "fixed" + to_string(m_totalBits) + "x" + to_string(m_fractionalDigits);
 }
@@ -967,6 +1094,10 @@ TypeResult RationalNumberType::binaryOperatorResult(Token _operator, Type const*
 	}
 	else
 	{
+		if (m_smallValue && other.m_smallValue)
+			if (auto result = smallIntegerBinaryOperation(_operator, *m_smallValue, *other.m_smallValue))
+				return TypeResult{TypeProvider::rationalNumber(rational(bigint(*result)))};
+
 		rational value;
 		bool fractional = isFractional() || other.isFractional();
 		switch (_operator)
@@ -1126,7 +1257,17 @@ TypeResult RationalNumberType::binaryOperatorResult(Token _operator, Type const*
 	}
 }
 
-string RationalNumberType::richIdentifier() const
+boost::optional<int64_t> RationalNumberType::smallInteger(rational const& _value)
+{
+	if (_value.denominator() != 1)
+		return {};
+	bigint const& numerator = _value.numerator();
+	if (numerator <= -c_smallIntegerLimit || numerator >= c_smallIntegerLimit)
+		return {};
+	return numerator.convert_to<int64_t>();
+}
+
+string RationalNumberType::computeRichIdentifier() const
 {
 	// rational seemingly will put the sign always on the numerator,
 	// but let just make it deterministic here.
@@ -1281,7 +1422,7 @@ BoolResult StringLiteralType::isImplicitlyConvertibleTo(Type const& _convertTo)
 		return false;
 }
 
-string StringLiteralType::richIdentifier() const
+string StringLiteralType::computeRichIdentifier() const
 {
 	// Since we have to return a valid identifier and the string itself may contain
 	// anything, we hash it.
@@ -1376,7 +1517,7 @@ MemberList::MemberMap FixedBytesType::nativeMembers(ContractDefinition const*) c
 	return MemberList::MemberMap{MemberList::Member{"length", TypeProvider::uint(8)}};
 }
 
-string FixedBytesType::richIdentifier() const
+string FixedBytesType::computeRichIdentifier() const
 {
 	return "t_bytes" + to_string(m_bytes);
 }
@@ -1604,7 +1745,7 @@ BoolResult ArrayType::isExplicitlyConvertibleTo(Type const& _convertTo) const
 	return true;
 }
 
-string ArrayType::richIdentifier() const
+string ArrayType::computeRichIdentifier() const
 {
 	string id;
 	if (isString())
@@ -1801,35 +1942,27 @@ TypePointer ArrayType::decodingType() const
 
 TypeResult ArrayType::interfaceType(bool _inLibrary) const
 {
-	if (_inLibrary && m_interfaceType_library.is_initialized())
-		return *m_interfaceType_library;
-
-	if (!_inLibrary && m_interfaceType.is_initialized())
-		return *m_interfaceType;
-
-	TypeResult result{TypePointer{}};
-	TypeResult baseInterfaceType = m_baseType->interfaceType(_inLibrary);
-
-	if (!baseInterfaceType.get())
+	return (_inLibrary ? m_interfaceType_library : m_interfaceType).get([&]()
 	{
-		solAssert(!baseInterfaceType.message().empty(), "Expected detailed error message!");
-		result = baseInterfaceType;
-	}
-	else if (_inLibrary && location() == DataLocation::Storage)
-		result = this;
-	else if (m_arrayKind != ArrayKind::Ordinary)
-		result = TypeProvider::withLocation(this, DataLocation::Memory, true);
-	else if (isDynamicallySized())
-		result = TypeProvider::array(DataLocation::Memory, baseInterfaceType);
-	else
-		result = TypeProvider::array(DataLocation::Memory, baseInterfaceType, m_length);
+		TypeResult result{TypePointer{}};
+		TypeResult baseInterfaceType = m_baseType->interfaceType(_inLibrary);
 
-	if (_inLibrary)
-		m_interfaceType_library = result;
-	else
-		m_interfaceType = result;
+		if (!baseInterfaceType.get())
+		{
+			solAssert(!baseInterfaceType.message().empty(), "Expected detailed error message!");
+			result = baseInterfaceType;
+		}
+		else if (_inLibrary && location() == DataLocation::Storage)
+			result = this;
+		else if (m_arrayKind != ArrayKind::Ordinary)
+			result = TypeProvider::withLocation(this, DataLocation::Memory, true);
+		else if (isDynamicallySized())
+			result = TypeProvider::array(DataLocation::Memory, baseInterfaceType);
+		else
+			result = TypeProvider::array(DataLocation::Memory, baseInterfaceType, m_length);
 
-	return result;
+		return result;
+	});
 }
 
 u256 ArrayType::memorySize() const
@@ -1852,7 +1985,7 @@ std::unique_ptr<ReferenceType> ArrayType::copyForLocation(DataLocation _location
 	return copy;
 }
 
-string ContractType::richIdentifier() const
+string ContractType::computeRichIdentifier() const
 {
 	return (m_super ? "t_super" : "t_contract") + parenthesizeUserIdentifier(m_contract.name()) + to_string(m_contract.id());
 }
@@ -1925,9 +2058,7 @@ MemberList::MemberMap ContractType::nativeMembers(ContractDefinition const* _con
 
 FunctionType const* ContractType::newExpressionType() const
 {
-	if (!m_constructorType)
-		m_constructorType = FunctionType::newExpressionType(m_contract);
-	return m_constructorType;
+	return m_constructorType.get([&]() { return FunctionType::newExpressionType(m_contract); });
 }
 
 vector<tuple<VariableDeclaration const*, u256, unsigned>> ContractType::stateVariables() const
@@ -1979,7 +2110,7 @@ BoolResult StructType::isImplicitlyConvertibleTo(Type const& _convertTo) const
 	return this->m_struct == convertTo.m_struct;
 }
 
-string StructType::richIdentifier() const
+string StructType::computeRichIdentifier() const
 {
 	return "t_struct" + parenthesizeUserIdentifier(m_struct.name()) + to_string(m_struct.id()) + identifierLocationSuffix();
 }
@@ -2082,15 +2213,17 @@ MemberList::MemberMap StructType::nativeMembers(ContractDefinition const*) const
 
 TypeResult StructType::interfaceType(bool _inLibrary) const
 {
-	if (_inLibrary && m_interfaceType_library.is_initialized())
-		return *m_interfaceType_library;
-
-	if (!_inLibrary && m_interfaceType.is_initialized())
-		return *m_interfaceType;
+	return (_inLibrary ? m_interfaceType_library : m_interfaceType).get([&]()
+	{
+		return computeInterfaceType(_inLibrary);
+	});
+}
 
+TypeResult StructType::computeInterfaceType(bool _inLibrary) const
+{
 	TypeResult result{TypePointer{}};
 
-	m_recursive = false;
+	bool recursive = false;
 
 	auto visitor = [&](
 		StructDefinition const& _struct,
@@ -2118,11 +2251,11 @@ TypeResult StructType::interfaceType(bool _inLibrary) const
 
 			if (StructType const* innerStruct = dynamic_cast<StructType const*>(memberType))
 				if (
-					innerStruct->m_recursive == true ||
+					(innerStruct->m_recursive.peek() && *innerStruct->m_recursive.peek()) ||
 					_cycleDetector.run(innerStruct->structDefinition())
 				)
 				{
-					m_recursive = true;
+					recursive = true;
 					if (_inLibrary && location() == DataLocation::Storage)
 						continue;
 					else
@@ -2142,33 +2275,25 @@ TypeResult StructType::interfaceType(bool _inLibrary) const
 		}
 	};
 
-	m_recursive = m_recursive.get() || (CycleDetector<StructDefinition>(visitor).run(structDefinition()) != nullptr);
-
-	std::string const recursiveErrMsg = "Recursive type not allowed for public or external contract functions.";
+	recursive = recursive || (CycleDetector<StructDefinition>(visitor).run(structDefinition()) != nullptr);
+	m_recursive.get([&]() { return recursive; });
 
 	if (_inLibrary)
 	{
 		if (!result.message().empty())
-			m_interfaceType_library = result;
+			return result;
 		else if (location() == DataLocation::Storage)
-			m_interfaceType_library = this;
+			return this;
 		else
-			m_interfaceType_library = TypeProvider::withLocation(this, DataLocation::Memory, true);
-
-		if (m_recursive.get())
-			m_interfaceType = TypeResult::err(recursiveErrMsg);
-
-		return *m_interfaceType_library;
+			return TypeProvider::withLocation(this, DataLocation::Memory, true);
 	}
 
-	if (m_recursive.get())
-		m_interfaceType = TypeResult::err(recursiveErrMsg);
+	if (recursive)
+		return TypeResult::err("Recursive type not allowed for public or external contract functions.");
 	else if (!result.message().empty())
-		m_interfaceType = result;
+		return result;
 	else
-		m_interfaceType = TypeProvider::withLocation(this, DataLocation::Memory, true);
-
-	return *m_interfaceType;
+		return TypeProvider::withLocation(this, DataLocation::Memory, true);
 }
 
 std::unique_ptr<ReferenceType> StructType::copyForLocation(DataLocation _location, bool _isPointer) const
@@ -2268,7 +2393,7 @@ TypeResult EnumType::unaryOperatorResult(Token _operator) const
 	return _operator == Token::Delete ? TypeProvider::emptyTuple() : nullptr;
 }
 
-string EnumType::richIdentifier() const
+string EnumType::computeRichIdentifier() const
 {
 	return "t_enum" + parenthesizeUserIdentifier(m_enum.name()) + to_string(m_enum.id());
 }
@@ -2342,7 +2467,7 @@ BoolResult TupleType::isImplicitlyConvertibleTo(Type const& _other) const
 		return false;
 }
 
-string TupleType::richIdentifier() const
+string TupleType::computeRichIdentifier() const
 {
 	return "t_tuple" + identifierList(components());
 }
@@ -2633,7 +2758,7 @@ TypePointers FunctionType::parameterTypes() const
 	return TypePointers(m_parameterTypes.cbegin() + 1, m_parameterTypes.cend());
 }
 
-string FunctionType::richIdentifier() const
+string FunctionType::computeRichIdentifier() const
 {
 	string id = "t_function_";
 	switch (m_kind)
@@ -3233,7 +3358,7 @@ Type const* MappingType::encodingType() const
 	return TypeProvider::integer(256, IntegerType::Modifier::Unsigned);
 }
 
-string MappingType::richIdentifier() const
+string MappingType::computeRichIdentifier() const
 {
 	return "t_mapping" + identifierList(m_keyType, m_valueType);
 }
@@ -3276,7 +3401,7 @@ TypeResult MappingType::interfaceType(bool _inLibrary) const
 	return this;
 }
 
-string TypeType::richIdentifier() const
+string TypeType::computeRichIdentifier() const
 {
 	return "t_type" + identifierList(actualType());
 }
@@ -3361,7 +3486,7 @@ u256 ModifierType::storageSize() const
 	solAssert(false, "Storage size of non-storable type type requested.");
 }
 
-string ModifierType::richIdentifier() const
+string ModifierType::computeRichIdentifier() const
 {
 	return "t_modifier" + identifierList(m_parameterTypes);
 }
@@ -3394,7 +3519,7 @@ string ModifierType::toString(bool _short) const
 	return name + ")";
 }
 
-string ModuleType::richIdentifier() const
+string ModuleType::computeRichIdentifier() const
 {
 	return "t_module_" + to_string(m_sourceUnit.id());
 }
@@ -3420,7 +3545,7 @@ string ModuleType::toString(bool) const
 	return string("module \"") + m_sourceUnit.annotation().path + string("\"");
 }
 
-string MagicType::richIdentifier() const
+string MagicType::computeRichIdentifier() const
 {
 	switch (m_kind)
 	{
@@ -29,6 +29,7 @@
 
 #include <libdevcore/Common.h>
 #include <libdevcore/CommonIO.h>
+#include <libdevcore/LazyInit.h>
 #include <libdevcore/Result.h>
 
 #include <boost/optional.hpp>
@@ -140,8 +141,10 @@ public:
 	MemberMap::const_iterator end() const { return m_memberTypes.end(); }
 
 private:
+	StorageOffsets const& storageOffsets() const;
+
 	MemberMap m_memberTypes;
-	mutable std::unique_ptr<StorageOffsets> m_storageOffsets;
+	mutable LazyInit<StorageOffsets> m_storageOffsets;
 };
 
 static_assert(std::is_nothrow_move_constructible<MemberList>::value, "MemberList should be noexcept move constructible");
@@ -175,12 +178,17 @@ public:
 	/// only if they have the same identifier.
 	/// The identifier should start with "t_".
 	/// Can contain characters which are invalid in identifiers.
-	virtual std::string richIdentifier() const = 0;
+	/// It is only computed once per type.
+	std::string const& richIdentifier() const;
 	/// @returns a valid solidity identifier such that two types should compare equal if and
 	/// only if they have the same identifier.
 	/// The identifier should start with "t_".
 	/// Will not contain any character which would be invalid as an identifier.
-	std::string identifier() const;
+	/// It is only computed once per type.
+	std::string const& identifier() const;
+	/// @returns a hash of identifier(), such that types that compare equal have the same hash.
+	/// Can be used to key containers by type, but is not suitable for generating names.
+	size_t identifierHash() const;
 
 	/// More complex identifier strings use "parentheses", where $_ is interpreted as
 	/// "opening parenthesis", _$ as "closing parenthesis", _$_ as "comma" and any $ that
@@ -316,6 +324,9 @@ private:
 	static MemberList::MemberMap boundFunctions(Type const& _type, ContractDefinition const& _scope);
 
 protected:
+	/// @returns the rich identifier of this type, see richIdentifier().
+	virtual std::string computeRichIdentifier() const = 0;
+
 	/// @returns the members native to this type depending on the given context. This function
 	/// is used (in conjunction with boundFunctions to fill m_members below.
 	virtual MemberList::MemberMap nativeMembers(ContractDefinition const* /*_currentScope*/) const
@@ -324,7 +335,15 @@ protected:
 	}
 
 	/// List of member types (parameterised by scape), will be lazy-initialized.
-	mutable std::map<ContractDefinition const*, std::unique_ptr<MemberList>> m_members;
+	/// Like all lazily computed properties of types, it can be queried concurrently.
+	mutable LazyInitMap<ContractDefinition const*, MemberList> m_members;
+
+private:
+	std::pair<std::string, size_t> const& identifierAndHash() const;
+
+	/// Identifiers and hash of this type, lazy-initialized.
+	mutable LazyInit<std::string> m_richIdentifier;
+	mutable LazyInit<std::pair<std::string, size_t>> m_identifier;
 };
 
 /**
@@ -337,7 +356,7 @@ public:
 
 	Category category() const override { return Category::Address; }
 
-	std::string richIdentifier() const override;
+	std::string computeRichIdentifier() const override;
 	BoolResult isImplicitlyConvertibleTo(Type const& _other) const override;
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
 	TypeResult unaryOperatorResult(Token _operator) const override;
@@ -381,7 +400,7 @@ public:
 
 	Category category() const override { return Category::Integer; }
 
-	std::string richIdentifier() const override;
+	std::string computeRichIdentifier() const override;
 	BoolResult isImplicitlyConvertibleTo(Type const& _convertTo) const override;
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
 	TypeResult unaryOperatorResult(Token _operator) const override;
@@ -424,7 +443,7 @@ public:
 	explicit FixedPointType(unsigned _totalBits, unsigned _fractionalDigits, Modifier _modifier = Modifier::Unsigned);
 	Category category() const override { return Category::FixedPoint; }
 
-	std::string richIdentifier() const override;
+	std::string computeRichIdentifier() const override;
 	BoolResult isImplicitlyConvertibleTo(Type const& _convertTo) const override;
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
 	TypeResult unaryOperatorResult(Token _operator) const override;
@@ -472,7 +491,7 @@ class RationalNumberType: public Type
 {
 public:
 	explicit RationalNumberType(rational const& _value, Type const* _compatibleBytesType = nullptr):
-		m_value(_value), m_compatibleBytesType(_compatibleBytesType)
+		m_value(_value), m_smallValue(smallInteger(_value)), m_compatibleBytesType(_compatibleBytesType)
 	{}
 
 	Category category() const override { return Category::RationalNumber; }
@@ -482,7 +501,7 @@ public:
 	TypeResult unaryOperatorResult(Token _operator) const override;
 	TypeResult binaryOperatorResult(Token _operator, Type const* _other) const override;
 
-	std::string richIdentifier() const override;
+	std::string computeRichIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 
 	bool canBeStored() const override { return false; }
@@ -513,6 +532,9 @@ public:
 
 private:
 	rational m_value;
+	/// The value if it is an integer of small magnitude. Arithmetic on such values avoids
+	/// the normalisation of the rational and falls back to it only if the result is not small.
+	boost::optional<int64_t> m_smallValue;
 
 	/// Bytes type to which the rational can be explicitly converted.
 	/// Empty for all rationals that are not directly parsed from hex literals.
@@ -521,6 +543,9 @@ private:
 	/// @returns true if the literal is a valid rational number.
 	static std::tuple<bool, rational> parseRational(std::string const& _value);
 
+	/// @returns @a _value as a machine integer if it is an integer whose absolute value is less than 2**62.
+	static boost::optional<int64_t> smallInteger(rational const& _value);
+
 	/// @returns a truncated readable representation of the bigint keeping only
 	/// up to 4 leading and 4 trailing digits.
 	static std::string bigintToReadableString(dev::bigint const& num);
@@ -543,7 +568,7 @@ public:
 		return nullptr;
 	}
 
-	std::string richIdentifier() const override;
+	std::string computeRichIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 
 	bool canBeStored() const override { return false; }
@@ -573,7 +598,7 @@ public:
 
 	BoolResult isImplicitlyConvertibleTo(Type const& _convertTo) const override;
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
-	std::string richIdentifier() const override;
+	std::string computeRichIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	TypeResult unaryOperatorResult(Token _operator) const override;
 	TypeResult binaryOperatorResult(Token _operator, Type const* _other) const override;
@@ -601,7 +626,7 @@ class BoolType: public Type
 {
 public:
 	Category category() const override { return Category::Bool; }
-	std::string richIdentifier() const override { return "t_bool"; }
+	std::string computeRichIdentifier() const override { return "t_bool"; }
 	TypeResult unaryOperatorResult(Token _operator) const override;
 	TypeResult binaryOperatorResult(Token _operator, Type const* _other) const override;
 
@@ -699,7 +724,7 @@ public:
 
 	BoolResult isImplicitlyConvertibleTo(Type const& _convertTo) const override;
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
-	std::string richIdentifier() const override;
+	std::string computeRichIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	unsigned calldataEncodedSize(bool _padded) const override;
 	bool isDynamicallySized() const override { return m_hasDynamicLength; }
@@ -748,8 +773,8 @@ private:
 	Type const* m_baseType;
 	bool m_hasDynamicLength = true;
 	u256 m_length;
-	mutable boost::optional<TypeResult> m_interfaceType;
-	mutable boost::optional<TypeResult> m_interfaceType_library;
+	mutable LazyInit<TypeResult> m_interfaceType;
+	mutable LazyInit<TypeResult> m_interfaceType_library;
 };
 
 /**
@@ -767,7 +792,7 @@ public:
 	/// Contracts can only be explicitly converted to address types and base contracts.
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
 	TypeResult unaryOperatorResult(Token _operator) const override;
-	std::string richIdentifier() const override;
+	std::string computeRichIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	unsigned calldataEncodedSize(bool _padded ) const override
 	{
@@ -813,7 +838,7 @@ private:
 	/// If true, this is a special "super" type of m_contract containing only members that m_contract inherited
 	bool m_super = false;
 	/// Type of the constructor, @see constructorType. Lazily initialized.
-	mutable FunctionType const* m_constructorType = nullptr;
+	mutable LazyInit<FunctionType const*> m_constructorType;
 };
 
 /**
@@ -827,7 +852,7 @@ public:
 
 	Category category() const override { return Category::Struct; }
 	BoolResult isImplicitlyConvertibleTo(Type const& _convertTo) const override;
-	std::string richIdentifier() const override;
+	std::string computeRichIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	unsigned calldataEncodedSize(bool _padded) const override;
 	bool isDynamicallyEncoded() const override;
@@ -843,12 +868,12 @@ public:
 
 	bool recursive() const
 	{
-		if (m_recursive.is_initialized())
-			return m_recursive.get();
+		if (bool const* recursive = m_recursive.peek())
+			return *recursive;
 
 		interfaceType(false);
 
-		return m_recursive.get();
+		return *m_recursive.peek();
 	}
 
 	std::unique_ptr<ReferenceType> copyForLocation(DataLocation _location, bool _isPointer) const override;
@@ -874,11 +899,13 @@ public:
 	void clearCache() const override;
 
 private:
+	TypeResult computeInterfaceType(bool _inLibrary) const;
+
 	StructDefinition const& m_struct;
 	// Caches for interfaceType(bool)
-	mutable boost::optional<TypeResult> m_interfaceType;
-	mutable boost::optional<TypeResult> m_interfaceType_library;
-	mutable boost::optional<bool> m_recursive;
+	mutable LazyInit<TypeResult> m_interfaceType;
+	mutable LazyInit<TypeResult> m_interfaceType_library;
+	mutable LazyInit<bool> m_recursive;
 };
 
 /**
@@ -891,7 +918,7 @@ public:
 
 	Category category() const override { return Category::Enum; }
 	TypeResult unaryOperatorResult(Token _operator) const override;
-	std::string richIdentifier() const override;
+	std::string computeRichIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	unsigned calldataEncodedSize(bool _padded) const override
 	{
@@ -932,7 +959,7 @@ public:
 	Category category() const override { return Category::Tuple; }
 
 	BoolResult isImplicitlyConvertibleTo(Type const& _other) const override;
-	std::string richIdentifier() const override;
+	std::string computeRichIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	TypeResult binaryOperatorResult(Token, Type const*) const override { return nullptr; }
 	std::string toString(bool) const override;
@@ -1086,7 +1113,7 @@ public:
 	/// @returns the "self" parameter type for a bound function
 	Type const* selfType() const;
 
-	std::string richIdentifier() const override;
+	std::string computeRichIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	BoolResult isImplicitlyConvertibleTo(Type const& _convertTo) const override;
 	BoolResult isExplicitlyConvertibleTo(Type const& _convertTo) const override;
@@ -1221,7 +1248,7 @@ public:
 
 	Category category() const override { return Category::Mapping; }
 
-	std::string richIdentifier() const override;
+	std::string computeRichIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	std::string toString(bool _short) const override;
 	std::string canonicalName() const override;
@@ -1255,7 +1282,7 @@ public:
 	Type const* actualType() const { return m_actualType; }
 
 	TypeResult binaryOperatorResult(Token, Type const*) const override { return nullptr; }
-	std::string richIdentifier() const override;
+	std::string computeRichIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	bool canBeStored() const override { return false; }
 	u256 storageSize() const override;
@@ -1286,7 +1313,7 @@ public:
 	bool canLiveOutsideStorage() const override { return false; }
 	unsigned sizeOnStack() const override { return 0; }
 	bool hasSimpleZeroValueInMemory() const override { solAssert(false, ""); }
-	std::string richIdentifier() const override;
+	std::string computeRichIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	std::string toString(bool _short) const override;
 
@@ -1307,7 +1334,7 @@ public:
 	Category category() const override { return Category::Module; }
 
 	TypeResult binaryOperatorResult(Token, Type const*) const override { return nullptr; }
-	std::string richIdentifier() const override;
+	std::string computeRichIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	bool canBeStored() const override { return false; }
 	bool canLiveOutsideStorage() const override { return true; }
@@ -1346,7 +1373,7 @@ public:
 		return nullptr;
 	}
 
-	std::string richIdentifier() const override;
+	std::string computeRichIdentifier() const override;
 	bool operator==(Type const& _other) const override;
 	bool canBeStored() const override { return false; }
 	bool canLiveOutsideStorage() const override { return true; }
@@ -1375,7 +1402,7 @@ class InaccessibleDynamicType: public Type
 public:
 	Category category() const override { return Category::InaccessibleDynamic; }
 
-	std::string richIdentifier() const override { return "t_inaccessible"; }
+	std::string computeRichIdentifier() const override { return "t_inaccessible"; }
 	BoolResult isImplicitlyConvertibleTo(Type const&) const override { return false; }
 	BoolResult isExplicitlyConvertibleTo(Type const&) const override { return false; }
 	TypeResult binaryOperatorResult(Token, Type const*) const override { return nullptr; }
@@ -54,8 +54,11 @@ void ArrayUtils::copyArrayToStorage(ArrayType const& _targetType, ArrayType cons
 	bool sourceIsStorage = _sourceType.location() == DataLocation::Storage;
 	bool fromCalldata = _sourceType.location() == DataLocation::CallData;
 	bool directCopy = sourceIsStorage && sourceBaseType->isValueType() && *sourceBaseType == *targetBaseType;
+	// Values copied from memory or calldata into packed storage are combined into full slots
+	// on the stack, such that every target slot is written only once.
+	bool packedCopy = !sourceIsStorage && sourceBaseType->isValueType() && targetBaseType->storageBytes() <= 16;
 	bool haveByteOffsetSource = !directCopy && sourceIsStorage && sourceBaseType->storageBytes() <= 16;
-	bool haveByteOffsetTarget = !directCopy && targetBaseType->storageBytes() <= 16;
+	bool haveByteOffsetTarget = !directCopy && !packedCopy && targetBaseType->storageBytes() <= 16;
 	unsigned byteOffsetSize = (haveByteOffsetSource ? 1 : 0) + (haveByteOffsetTarget ? 1 : 0);
 
 	// stack: source_ref [source_length] target_ref
@@ -167,6 +170,16 @@ void ArrayUtils::copyArrayToStorage(ArrayType const& _targetType, ArrayType cons
 			utils.convertLengthToSize(_sourceType);
 			_context << Instruction::DUP3 << Instruction::ADD;
 			// stack: target_ref target_data_end source_data_pos target_data_pos source_data_end
+			if (packedCopy)
+			{
+				utils.copyValuesToPackedStorage(*sourceBaseType, *targetBaseType, fromCalldata);
+				_context << copyLoopEndWithoutByteOffset;
+				// zero-out leftovers in target, the last written slot is already complete
+				_context << Instruction::POP << Instruction::SWAP1 << Instruction::POP;
+				utils.clearStorageLoop(TypeProvider::uint256());
+				_context << Instruction::POP;
+				return;
+			}
 			if (haveByteOffsetTarget)
 				_context << u256(0);
 			if (haveByteOffsetSource)
@@ -281,7 +294,8 @@ void ArrayUtils::copyArrayToStorage(ArrayType const& _targetType, ArrayType cons
 			// stack: target_ref target_data_end source_data_pos target_data_pos_updated source_data_end
 			_context << Instruction::POP << Instruction::SWAP1 << Instruction::POP;
 			// stack: target_ref target_data_end target_data_pos_updated
-			utils.clearStorageLoop(targetBaseType);
+			// The copy loops end at a slot boundary, so packed slots can be cleared as a whole.
+			utils.clearStorageLoop(targetBaseType->storageBytes() < 32 ? TypeProvider::uint256() : targetBaseType);
 			_context << Instruction::POP;
 		}
 	);
@@ -469,52 +483,43 @@ void ArrayUtils::copyArrayToMemory(ArrayType const& _sourceType, bool _padToWord
 		}
 
 		// stack here: memory_end_offset storage_data_offset memory_offset
-		bool haveByteOffset = !_sourceType.isByteArray() && storageBytes <= 16;
-		if (haveByteOffset)
-			m_context << u256(0) << Instruction::SWAP1;
-		// stack here: memory_end_offset storage_data_offset [storage_byte_offset] memory_offset
-		eth::AssemblyItem loopStart = m_context.newTag();
-		m_context << loopStart;
-		// load and store
-		if (_sourceType.isByteArray())
-		{
-			// Packed both in storage and memory.
-			m_context << Instruction::DUP2 << Instruction::SLOAD;
-			m_context << Instruction::DUP2 << Instruction::MSTORE;
-			// increment storage_data_offset by 1
-			m_context << Instruction::SWAP1 << u256(1) << Instruction::ADD;
-			// increment memory offset by 32
-			m_context << Instruction::SWAP1 << u256(32) << Instruction::ADD;
-		}
+		if (!_sourceType.isByteArray() && storageBytes <= 16)
+			copyPackedStorageToMemory(*_sourceType.baseType());
 		else
 		{
-			// stack here: memory_end_offset storage_data_offset [storage_byte_offset] memory_offset
-			if (haveByteOffset)
-				m_context << Instruction::DUP3 << Instruction::DUP3;
-			else
-				m_context << Instruction::DUP2 << u256(0);
-			StorageItem(m_context, *_sourceType.baseType()).retrieveValue(SourceLocation(), true);
-			if (auto baseArray = dynamic_cast<ArrayType const*>(_sourceType.baseType()))
-				copyArrayToMemory(*baseArray, _padToWordBoundaries);
-			else
-				utils.storeInMemoryDynamic(*_sourceType.baseType());
-			// increment storage_data_offset and byte offset
-			if (haveByteOffset)
-				incrementByteOffset(storageBytes, 2, 3);
+			eth::AssemblyItem loopStart = m_context.newTag();
+			m_context << loopStart;
+			// load and store
+			if (_sourceType.isByteArray())
+			{
+				// Packed both in storage and memory.
+				m_context << Instruction::DUP2 << Instruction::SLOAD;
+				m_context << Instruction::DUP2 << Instruction::MSTORE;
+				// increment storage_data_offset by 1
+				m_context << Instruction::SWAP1 << u256(1) << Instruction::ADD;
+				// increment memory offset by 32
+				m_context << Instruction::SWAP1 << u256(32) << Instruction::ADD;
+			}
 			else
 			{
+				// stack here: memory_end_offset storage_data_offset memory_offset
+				m_context << Instruction::DUP2 << u256(0);
+				StorageItem(m_context, *_sourceType.baseType()).retrieveValue(SourceLocation(), true);
+				if (auto baseArray = dynamic_cast<ArrayType const*>(_sourceType.baseType()))
+					copyArrayToMemory(*baseArray, _padToWordBoundaries);
+				else
+					utils.storeInMemoryDynamic(*_sourceType.baseType());
+				// increment storage_data_offset
 				m_context << Instruction::SWAP1;
 				m_context << storageSize << Instruction::ADD;
 				m_context << Instruction::SWAP1;
 			}
+			// check for loop condition
+			m_context << Instruction::DUP1 << Instruction::DUP4;
+			m_context << Instruction::GT;
+			m_context.appendConditionalJumpTo(loopStart);
 		}
-		// check for loop condition
-		m_context << Instruction::DUP1 << dupInstruction(haveByteOffset ? 5 : 4);
-		m_context << Instruction::GT;
-		m_context.appendConditionalJumpTo(loopStart);
-		// stack here: memory_end_offset storage_data_offset [storage_byte_offset] memory_offset
-		if (haveByteOffset)
-			m_context << Instruction::SWAP1 << Instruction::POP;
+		// stack here: memory_end_offset storage_data_offset memory_offset
 		if (_padToWordBoundaries && baseSize % 32 != 0)
 		{
 			// memory_end_offset - start is the actual length (we want to compute the ceil of).
@@ -1132,6 +1137,89 @@ void ArrayUtils::accessIndex(ArrayType const& _arrayType, bool _doBoundsCheck, b
 	}
 }
 
+void ArrayUtils::copyValuesToPackedStorage(
+	Type const& _sourceBaseType,
+	Type const& _targetBaseType,
+	bool _fromCalldata
+) const
+{
+	unsigned storageBytes = _targetBaseType.storageBytes();
+	solAssert(storageBytes <= 16, "");
+	solAssert(_sourceBaseType.isValueType(), "");
+	u256 stride = _fromCalldata ? _sourceBaseType.calldataEncodedSize(true) : _sourceBaseType.memoryHeadSize();
+	u256 multiplierStep = u256(1) << (8 * storageBytes);
+	u256 lastMultiplier = u256(1) << (8 * storageBytes * (32 / storageBytes - 1));
+	StorageItem target(m_context, _targetBaseType);
+
+	// stack: source_data_pos target_data_pos source_data_end
+	eth::AssemblyItem slotLoopStart = m_context.newTag();
+	m_context << slotLoopStart;
+	m_context << u256(0) << u256(1);
+	// stack: source_data_pos target_data_pos source_data_end slot_value multiplier
+	eth::AssemblyItem elementLoopStart = m_context.newTag();
+	m_context << elementLoopStart;
+	m_context << Instruction::DUP5;
+	CompilerUtils(m_context).loadFromMemoryDynamic(_sourceBaseType, _fromCalldata, true, false);
+	target.packForSlot(_sourceBaseType);
+	// stack: source_data_pos target_data_pos source_data_end slot_value multiplier packed_value
+	m_context << Instruction::DUP2 << Instruction::MUL << Instruction::DUP3 << Instruction::OR;
+	m_context << Instruction::SWAP2 << Instruction::POP;
+	// increment source_data_pos
+	m_context << Instruction::SWAP4 << stride << Instruction::ADD << Instruction::SWAP4;
+	// store the slot if it is full
+	m_context << Instruction::DUP1 << lastMultiplier << Instruction::EQ;
+	eth::AssemblyItem slotFull = m_context.appendConditionalJump();
+	m_context << multiplierStep << Instruction::MUL;
+	// continue with the next element if source_data_end > source_data_pos
+	m_context << Instruction::DUP5 << Instruction::DUP4 << Instruction::GT;
+	m_context.appendConditionalJumpTo(elementLoopStart);
+	m_context << slotFull;
+	// stack: source_data_pos target_data_pos source_data_end slot_value multiplier
+	m_context << Instruction::POP << Instruction::DUP3 << Instruction::SSTORE;
+	// increment target_data_pos
+	m_context << Instruction::SWAP1 << u256(1) << Instruction::ADD << Instruction::SWAP1;
+	// continue with the next slot if source_data_pos < source_data_end
+	m_context << Instruction::DUP1 << Instruction::DUP4 << Instruction::LT;
+	m_context.appendConditionalJumpTo(slotLoopStart);
+	// stack: source_data_pos target_data_pos source_data_end
+}
+
+void ArrayUtils::copyPackedStorageToMemory(Type const& _baseType) const
+{
+	unsigned storageBytes = _baseType.storageBytes();
+	solAssert(storageBytes <= 16, "");
+	u256 multiplierStep = u256(1) << (8 * storageBytes);
+	u256 lastMultiplier = u256(1) << (8 * storageBytes * (32 / storageBytes - 1));
+	StorageItem source(m_context, _baseType);
+
+	// stack: memory_end_offset storage_data_offset memory_offset
+	eth::AssemblyItem slotLoopStart = m_context.newTag();
+	m_context << slotLoopStart;
+	m_context << Instruction::DUP2 << Instruction::SLOAD << Instruction::SWAP1;
+	m_context << u256(1) << Instruction::SWAP1;
+	// stack: memory_end_offset storage_data_offset slot_value multiplier memory_offset
+	eth::AssemblyItem elementLoopStart = m_context.newTag();
+	m_context << elementLoopStart;
+	m_context << Instruction::DUP3 << Instruction::DUP3;
+	source.unpackFromSlot();
+	CompilerUtils(m_context).storeInMemoryDynamic(_baseType);
+	// stack: memory_end_offset storage_data_offset slot_value multiplier memory_offset
+	m_context << Instruction::DUP1 << Instruction::DUP6 << Instruction::GT << Instruction::ISZERO;
+	eth::AssemblyItem copyDone = m_context.appendConditionalJump();
+	m_context << Instruction::DUP2 << lastMultiplier << Instruction::EQ;
+	eth::AssemblyItem slotDone = m_context.appendConditionalJump();
+	m_context << Instruction::SWAP1 << multiplierStep << Instruction::MUL << Instruction::SWAP1;
+	m_context.appendJumpTo(elementLoopStart);
+	m_context << slotDone;
+	m_context << Instruction::SWAP2 << Instruction::POP << Instruction::POP;
+	// increment storage_data_offset
+	m_context << Instruction::SWAP1 << u256(1) << Instruction::ADD << Instruction::SWAP1;
+	m_context.appendJumpTo(slotLoopStart);
+	m_context << copyDone;
+	m_context << Instruction::SWAP2 << Instruction::POP << Instruction::POP;
+	// stack: memory_end_offset storage_data_offset memory_offset
+}
+
 void ArrayUtils::incrementByteOffset(unsigned _byteSize, unsigned _byteOffsetPosition, unsigned _storageOffsetPosition) const
 {
 	solAssert(_byteSize < 32, "");
@@ -106,6 +106,17 @@ public:
 	void accessIndex(ArrayType const& _arrayType, bool _doBoundsCheck = true, bool _keepReference = false) const;
 
 private:
+	/// Copies values from memory or calldata to packed storage, writing each target slot only once.
+	/// The remaining bytes of the last written slot are zeroed.
+	/// Stack pre: source_data_pos target_data_pos source_data_end
+	/// Stack post: source_data_pos_updated target_data_pos_updated source_data_end
+	/// where source_data_pos < source_data_end has to hold.
+	void copyValuesToPackedStorage(Type const& _sourceBaseType, Type const& _targetBaseType, bool _fromCalldata) const;
+	/// Copies packed values from storage to memory, loading each source slot only once.
+	/// Stack pre: memory_end_offset storage_data_offset memory_offset
+	/// Stack post: memory_end_offset storage_data_offset_updated memory_offset_updated
+	/// where memory_offset < memory_end_offset has to hold.
+	void copyPackedStorageToMemory(Type const& _baseType) const;
 	/// Adds the given number of bytes to a storage byte offset counter and also increments
 	/// the storage offset if adding this number again would increase the counter over 32.
 	/// @param byteOffsetPosition the stack offset of the storage byte offset
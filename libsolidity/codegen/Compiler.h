@@ -35,10 +35,17 @@ namespace solidity {
 class Compiler
 {
 public:
-	explicit Compiler(langutil::EVMVersion _evmVersion, OptimiserSettings _optimiserSettings):
+	/// @param _yulFunctionCache if given, generated Yul functions are shared through this cache.
+	/// @param _inlineAssemblyCache if given, parsed inline assembly is shared through this cache.
+	explicit Compiler(
+		langutil::EVMVersion _evmVersion,
+		OptimiserSettings _optimiserSettings,
+		std::shared_ptr<MultiUseYulFunctionCache> const& _yulFunctionCache = nullptr,
+		std::shared_ptr<InlineAssemblyCache> const& _inlineAssemblyCache = nullptr
+	):
 		m_optimiserSettings(std::move(_optimiserSettings)),
-		m_runtimeContext(_evmVersion),
-		m_context(_evmVersion, &m_runtimeContext)
+		m_runtimeContext(_evmVersion, nullptr, _yulFunctionCache, _inlineAssemblyCache),
+		m_context(_evmVersion, &m_runtimeContext, _yulFunctionCache, _inlineAssemblyCache)
 	{ }
 
 	/// Compiles a contract.
@@ -57,6 +57,26 @@ using namespace dev::eth;
 using namespace dev;
 using namespace dev::solidity;
 
+bool InlineAssemblyCache::Key::operator<(Key const& _other) const
+{
+	return
+		tie(assembly, localVariables, externallyUsedFunctions, evmVersion, optimize, optimizeStackAllocation) <
+		tie(_other.assembly, _other.localVariables, _other.externallyUsedFunctions, _other.evmVersion, _other.optimize, _other.optimizeStackAllocation);
+}
+
+shared_ptr<InlineAssemblyCache::Entry const> InlineAssemblyCache::find(Key const& _key) const
+{
+	lock_guard<mutex> lock(m_mutex);
+	auto it = m_entries.find(_key);
+	return it == m_entries.end() ? nullptr : it->second;
+}
+
+void InlineAssemblyCache::store(Key _key, shared_ptr<Entry const> _entry)
+{
+	lock_guard<mutex> lock(m_mutex);
+	m_entries.emplace(move(_key), move(_entry));
+}
+
 void CompilerContext::addStateVariable(
 	VariableDeclaration const& _declaration,
 	u256 const& _storageOffset,
@@ -379,6 +399,55 @@ void CompilerContext::appendInlineAssembly(
 		}
 	};
 
+	// Several optimizer steps cannot handle externally supplied stack variables,
+	// so we essentially only optimize the ABI functions.
+	bool const optimize = _optimiserSettings.runYulOptimiser && _localVariables.empty();
+
+	InlineAssemblyCache::Key cacheKey{
+		_assembly,
+		_localVariables,
+		_externallyUsedFunctions,
+		m_evmVersion.name(),
+		optimize,
+		_optimiserSettings.optimizeStackAllocation
+	};
+	shared_ptr<InlineAssemblyCache::Entry const> parsed =
+		m_inlineAssemblyCache ? m_inlineAssemblyCache->find(cacheKey) : nullptr;
+	if (!parsed)
+	{
+		parsed = parseAndAnalyzeInlineAssembly(
+			_assembly,
+			identifierAccess,
+			externallyUsedIdentifiers,
+			optimize,
+			_optimiserSettings
+		);
+		if (m_inlineAssemblyCache)
+			m_inlineAssemblyCache->store(move(cacheKey), parsed);
+	}
+
+	yul::CodeGenerator::assemble(
+		*parsed->code,
+		*parsed->analysisInfo,
+		*m_asm,
+		m_evmVersion,
+		identifierAccess,
+		_system,
+		_optimiserSettings.optimizeStackAllocation
+	);
+
+	// Reset the source location to the one of the node (instead of the CODEGEN source location)
+	updateSourceLocation();
+}
+
+shared_ptr<InlineAssemblyCache::Entry const> CompilerContext::parseAndAnalyzeInlineAssembly(
+	string const& _assembly,
+	yul::ExternalIdentifierAccess const& _identifierAccess,
+	set<yul::YulString> const& _externallyUsedIdentifiers,
+	bool _optimize,
+	OptimiserSettings const& _optimiserSettings
+) const
+{
 	ErrorList errors;
 	ErrorReporter errorReporter(errors);
 	auto scanner = make_shared<langutil::Scanner>(langutil::CharStream(_assembly, "--CODEGEN--"));
@@ -402,37 +471,35 @@ void CompilerContext::appendInlineAssembly(
 		solAssert(false, message);
 	};
 
-	yul::AsmAnalysisInfo analysisInfo;
+	auto analysisInfo = make_shared<yul::AsmAnalysisInfo>();
 	bool analyzerResult = false;
 	if (parserResult)
 		analyzerResult = yul::AsmAnalyzer(
-			analysisInfo,
+			*analysisInfo,
 			errorReporter,
 			boost::none,
 			yul::EVMDialect::strictAssemblyForEVM(m_evmVersion),
-			identifierAccess.resolve
+			_identifierAccess.resolve
 		).analyze(*parserResult);
 	if (!parserResult || !errorReporter.errors().empty() || !analyzerResult)
 		reportError("Invalid assembly generated by code generator.");
 
-	// Several optimizer steps cannot handle externally supplied stack variables,
-	// so we essentially only optimize the ABI functions.
-	if (_optimiserSettings.runYulOptimiser && _localVariables.empty())
+	if (_optimize)
 	{
 		yul::OptimiserSuite::run(
 			yul::EVMDialect::strictAssemblyForEVM(m_evmVersion),
 			*parserResult,
-			analysisInfo,
+			*analysisInfo,
 			_optimiserSettings.optimizeStackAllocation,
-			externallyUsedIdentifiers
+			_externallyUsedIdentifiers
 		);
-		analysisInfo = yul::AsmAnalysisInfo{};
+		analysisInfo = make_shared<yul::AsmAnalysisInfo>();
 		if (!yul::AsmAnalyzer(
-			analysisInfo,
+			*analysisInfo,
 			errorReporter,
 			boost::none,
 			yul::EVMDialect::strictAssemblyForEVM(m_evmVersion),
-			identifierAccess.resolve
+			_identifierAccess.resolve
 		).analyze(*parserResult))
 			reportError("Optimizer introduced error into inline assembly.");
 #ifdef SOL_OUTPUT_ASM
@@ -445,18 +512,7 @@ void CompilerContext::appendInlineAssembly(
 		reportError("Failed to analyze inline assembly block.");
 
 	solAssert(errorReporter.errors().empty(), "Failed to analyze inline assembly block.");
-	yul::CodeGenerator::assemble(
-		*parserResult,
-		analysisInfo,
-		*m_asm,
-		m_evmVersion,
-		identifierAccess,
-		_system,
-		_optimiserSettings.optimizeStackAllocation
-	);
-
-	// Reset the source location to the one of the node (instead of the CODEGEN source location)
-	updateSourceLocation();
+	return make_shared<InlineAssemblyCache::Entry const>(InlineAssemblyCache::Entry{move(parserResult), move(analysisInfo)});
 }
 
 FunctionDefinition const& CompilerContext::resolveVirtualFunction(
@@ -492,10 +548,13 @@ void CompilerContext::updateSourceLocation()
 	m_asm->setSourceLocation(m_visitedNodes.empty() ? SourceLocation() : m_visitedNodes.top()->location());
 }
 
-eth::Assembly::OptimiserSettings CompilerContext::translateOptimiserSettings(OptimiserSettings const& _settings)
+eth::Assembly::OptimiserSettings CompilerContext::translateOptimiserSettings(
+	OptimiserSettings const& _settings,
+	langutil::EVMVersion _evmVersion
+)
 {
 	// Constructing it this way so that we notice changes in the fields.
-	eth::Assembly::OptimiserSettings asmSettings{false, false, false, false, false, false, m_evmVersion, 0};
+	eth::Assembly::OptimiserSettings asmSettings{false, false, false, false, false, false, _evmVersion, 0};
 	asmSettings.isCreation = true;
 	asmSettings.runJumpdestRemover = _settings.runJumpdestRemover;
 	asmSettings.runPeephole = _settings.runPeephole;
@@ -503,7 +562,7 @@ eth::Assembly::OptimiserSettings CompilerContext::translateOptimiserSettings(Opt
 	asmSettings.runCSE = _settings.runCSE;
 	asmSettings.runConstantOptimiser = _settings.runConstantOptimiser;
 	asmSettings.expectedExecutionsPerDeployment = _settings.expectedExecutionsPerDeployment;
-	asmSettings.evmVersion = m_evmVersion;
+	asmSettings.evmVersion = _evmVersion;
 	return asmSettings;
 }
 
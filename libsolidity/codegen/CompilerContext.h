@@ -29,22 +29,68 @@
 
 #include <libsolidity/interface/OptimiserSettings.h>
 
+#include <libyul/AsmDataForward.h>
+
 #include <libevmasm/Assembly.h>
 #include <libevmasm/Instruction.h>
 #include <liblangutil/EVMVersion.h>
 #include <libdevcore/Common.h>
 
 #include <functional>
+#include <mutex>
 #include <ostream>
 #include <stack>
 #include <queue>
 #include <utility>
 
+namespace yul
+{
+struct AsmAnalysisInfo;
+struct ExternalIdentifierAccess;
+class YulString;
+}
+
 namespace dev {
 namespace solidity {
 
 class Compiler;
 
+/**
+ * Cache of inline assembly blocks appended by the code generator, in parsed, analysed and
+ * (if requested) optimised form. Can be shared by the compiler contexts of all contracts
+ * of a compilation.
+ */
+class InlineAssemblyCache
+{
+public:
+	/// The source of a block and everything that influences its analysis and optimisation.
+	struct Key
+	{
+		std::string assembly;
+		std::vector<std::string> localVariables;
+		std::set<std::string> externallyUsedFunctions;
+		std::string evmVersion;
+		bool optimize;
+		bool optimizeStackAllocation;
+
+		bool operator<(Key const& _other) const;
+	};
+	struct Entry
+	{
+		std::shared_ptr<yul::Block const> code;
+		/// Analysis of @a code. Only read during code generation.
+		std::shared_ptr<yul::AsmAnalysisInfo> analysisInfo;
+	};
+
+	/// @returns the entry for @a _key or nullptr if there is none.
+	std::shared_ptr<Entry const> find(Key const& _key) const;
+	void store(Key _key, std::shared_ptr<Entry const> _entry);
+
+private:
+	mutable std::mutex m_mutex;
+	std::map<Key, std::shared_ptr<Entry const>> m_entries;
+};
+
 /**
  * Context to be shared by all units that compile the same contract.
  * It stores the generated bytecode and the position of identifiers in memory and on the stack.
@@ -52,11 +98,20 @@ class Compiler;
 class CompilerContext
 {
 public:
-	explicit CompilerContext(langutil::EVMVersion _evmVersion, CompilerContext* _runtimeContext = nullptr):
+	/// @param _yulFunctionCache if given, the Yul functions of the ABI coder are shared through this cache.
+	/// @param _inlineAssemblyCache if given, appended inline assembly is parsed and optimised only
+	/// once per cache.
+	explicit CompilerContext(
+		langutil::EVMVersion _evmVersion,
+		CompilerContext* _runtimeContext = nullptr,
+		std::shared_ptr<MultiUseYulFunctionCache> const& _yulFunctionCache = nullptr,
+		std::shared_ptr<InlineAssemblyCache> const& _inlineAssemblyCache = nullptr
+	):
 		m_asm(std::make_shared<eth::Assembly>()),
 		m_evmVersion(_evmVersion),
 		m_runtimeContext(_runtimeContext),
-		m_abiFunctions(m_evmVersion)
+		m_abiFunctions(m_evmVersion, std::make_shared<MultiUseYulFunctionCollector>(_yulFunctionCache)),
+		m_inlineAssemblyCache(_inlineAssemblyCache)
 	{
 		if (m_runtimeContext)
 			m_runtimeSub = size_t(m_asm->newSub(m_runtimeContext->m_asm).data());
@@ -224,7 +279,13 @@ public:
 	void appendAuxiliaryData(bytes const& _data) { m_asm->appendAuxiliaryDataToEnd(_data); }
 
 	/// Run optimisation step.
-	void optimise(OptimiserSettings const& _settings) { m_asm->optimise(translateOptimiserSettings(_settings)); }
+	void optimise(OptimiserSettings const& _settings) { m_asm->optimise(translateOptimiserSettings(_settings, m_evmVersion)); }
+
+	/// @returns the settings of the assembly optimiser for a creation assembly corresponding to @a _settings.
+	static eth::Assembly::OptimiserSettings translateOptimiserSettings(
+		OptimiserSettings const& _settings,
+		langutil::EVMVersion _evmVersion
+	);
 
 	/// @returns the runtime context if in creation mode and runtime context is set, nullptr otherwise.
 	CompilerContext* runtimeContext() const { return m_runtimeContext; }
@@ -263,6 +324,16 @@ public:
 	};
 
 private:
+	/// Parses and analyses the inline assembly @a _assembly and optimises it if @a _optimize is set.
+	/// Fails with an assertion if the code is invalid.
+	std::shared_ptr<InlineAssemblyCache::Entry const> parseAndAnalyzeInlineAssembly(
+		std::string const& _assembly,
+		yul::ExternalIdentifierAccess const& _identifierAccess,
+		std::set<yul::YulString> const& _externallyUsedIdentifiers,
+		bool _optimize,
+		OptimiserSettings const& _optimiserSettings
+	) const;
+
 	/// Searches the inheritance hierarchy towards the base starting from @a _searchStart and returns
 	/// the first function definition that is overwritten by _function.
 	FunctionDefinition const& resolveVirtualFunction(
@@ -274,8 +345,6 @@ private:
 	/// Updates source location set in the assembly.
 	void updateSourceLocation();
 
-	eth::Assembly::OptimiserSettings translateOptimiserSettings(OptimiserSettings const& _settings);
-
 	/**
 	 * Helper class that manages function labels and ensures that referenced functions are
 	 * compiled in a specific order.
@@ -334,6 +403,8 @@ private:
 	std::map<std::string, eth::AssemblyItem> m_lowLevelFunctions;
 	/// Container for ABI functions to be generated.
 	ABIFunctions m_abiFunctions;
+	/// Cache of parsed and optimised inline assembly, might be shared with other contexts.
+	std::shared_ptr<InlineAssemblyCache> m_inlineAssemblyCache;
 	/// The queue of low-level functions to generate.
 	std::queue<std::tuple<std::string, unsigned, unsigned, std::function<void(CompilerContext&)>>> m_lowLevelFunctionGenerationQueue;
 };
@@ -60,6 +60,237 @@ private:
 	unsigned stackHeight;
 };
 
+bool isMemoryReference(Type const& _type)
+{
+	if (auto tupleType = dynamic_cast<TupleType const*>(&_type))
+	{
+		for (auto const& component: tupleType->components())
+			if (component && isMemoryReference(*component))
+				return true;
+		return false;
+	}
+	auto referenceType = dynamic_cast<ReferenceType const*>(&_type);
+	return referenceType && referenceType->location() == DataLocation::Memory;
+}
+
+/**
+ * Escape analysis for memory allocated during the evaluation of an expression whose value is
+ * discarded or stored in variables that are not memory references.
+ * Such memory cannot be referenced afterwards unless a memory reference is assigned or handed
+ * to an internal function, so the free memory pointer can be reset after the evaluation.
+ */
+class TemporaryMemoryChecker: private ASTConstVisitor
+{
+public:
+	/// @returns true if @a _expression allocates memory and all of it is temporary.
+	static bool onlyTemporaryAllocations(Expression const& _expression)
+	{
+		TemporaryMemoryChecker checker;
+		_expression.accept(checker);
+		return checker.m_allocates && !checker.m_escapes;
+	}
+
+private:
+	bool visit(Assignment const& _assignment) override
+	{
+		if (isMemoryReference(*_assignment.annotation().type))
+			m_escapes = true;
+		return !m_escapes;
+	}
+	bool visit(UnaryOperation const& _operation) override
+	{
+		// Deleting a memory variable assigns a new zero-initialised memory object to it.
+		if (_operation.getOperator() == Token::Delete && isMemoryReference(*_operation.subExpression().annotation().type))
+			m_escapes = true;
+		return !m_escapes;
+	}
+	bool visit(TupleExpression const& _tuple) override
+	{
+		if (_tuple.isInlineArray())
+			m_allocates = true;
+		return !m_escapes;
+	}
+	bool visit(FunctionCall const& _functionCall) override
+	{
+		switch (_functionCall.annotation().kind)
+		{
+		case FunctionCallKind::TypeConversion:
+			if (isMemoryReference(*_functionCall.annotation().type))
+				m_allocates = true;
+			break;
+		case FunctionCallKind::StructConstructorCall:
+			m_allocates = true;
+			break;
+		case FunctionCallKind::FunctionCall:
+			switch (dynamic_cast<FunctionType const&>(*_functionCall.expression().annotation().type).kind())
+			{
+			case FunctionType::Kind::ABIEncode:
+			case FunctionType::Kind::ABIEncodePacked:
+			case FunctionType::Kind::ABIEncodeWithSelector:
+			case FunctionType::Kind::ABIEncodeWithSignature:
+			case FunctionType::Kind::ABIDecode:
+			case FunctionType::Kind::ObjectCreation:
+			case FunctionType::Kind::External:
+			case FunctionType::Kind::DelegateCall:
+			case FunctionType::Kind::BareCall:
+			case FunctionType::Kind::BareCallCode:
+			case FunctionType::Kind::BareDelegateCall:
+			case FunctionType::Kind::BareStaticCall:
+			case FunctionType::Kind::Creation:
+				m_allocates = true;
+				break;
+			case FunctionType::Kind::Send:
+			case FunctionType::Kind::Transfer:
+			case FunctionType::Kind::KECCAK256:
+			case FunctionType::Kind::ECRecover:
+			case FunctionType::Kind::SHA256:
+			case FunctionType::Kind::RIPEMD160:
+			case FunctionType::Kind::Log0:
+			case FunctionType::Kind::Log1:
+			case FunctionType::Kind::Log2:
+			case FunctionType::Kind::Log3:
+			case FunctionType::Kind::Log4:
+			case FunctionType::Kind::Event:
+			case FunctionType::Kind::SetGas:
+			case FunctionType::Kind::SetValue:
+			case FunctionType::Kind::BlockHash:
+			case FunctionType::Kind::AddMod:
+			case FunctionType::Kind::MulMod:
+			case FunctionType::Kind::GasLeft:
+			case FunctionType::Kind::Require:
+			case FunctionType::Kind::Assert:
+			case FunctionType::Kind::Revert:
+				break;
+			default:
+				// Internal functions can store references to new memory objects in existing ones.
+				m_escapes = true;
+				break;
+			}
+			break;
+		default:
+			m_escapes = true;
+			break;
+		}
+		return !m_escapes;
+	}
+
+	bool m_allocates = false;
+	bool m_escapes = false;
+};
+
+/// @returns true if a binary split function selector splits the range of @a _count function
+/// IDs, see ContractCompiler::appendInternalSelector for the cost model.
+bool splitSelector(size_t _count, size_t _runs)
+{
+	// Start with some comparisons to avoid overflow, then do the actual comparison.
+	if (_count <= 4)
+		return false;
+	else if (_runs > (17 * eth::GasCosts::createDataGas) / 6)
+		return true;
+	else
+		return (_runs * 6 * (_count - 4) > 17 * eth::GasCosts::createDataGas);
+}
+
+/// Execution gas of dispatching to each of the functions, summed up over all functions,
+/// and code size of a function selector, assuming two byte tags.
+struct SelectorCost
+{
+	bigint gas;
+	size_t size = 0;
+};
+
+// dup1, push4 <id>, eq/gt, push2 <tag>, jumpi
+size_t const c_selectorComparisonGas = 3 + 3 + 3 + 3 + 10;
+size_t const c_selectorComparisonSize = 1 + 5 + 1 + 3 + 1;
+// Code of ContractCompiler::appendJumpTableSelector up to the jump into the table,
+// computing the hash without shift instructions.
+size_t const c_jumpTableDispatchGas = 145;
+size_t const c_jumpTableDispatchSize = 68;
+
+void addSplitSelectorCost(size_t _count, size_t _runs, SelectorCost& _cost)
+{
+	if (splitSelector(_count, _runs))
+	{
+		size_t smaller = _count / 2;
+		// the smaller half additionally pays for the jumpdest
+		_cost.gas += c_selectorComparisonGas * _count + smaller;
+		_cost.size += c_selectorComparisonSize + 1;
+		addSplitSelectorCost(_count - smaller, _runs, _cost);
+		addSplitSelectorCost(smaller, _runs, _cost);
+	}
+	else
+	{
+		_cost.gas += c_selectorComparisonGas * _count * (_count + 1) / 2;
+		// push2 <notfound> jump
+		_cost.size += c_selectorComparisonSize * _count + 4;
+	}
+}
+
+SelectorCost jumpTableSelectorCost(ContractCompiler::SelectorHash const& _hash, vector<FixedHash<4>> const& _ids)
+{
+	vector<size_t> bucketSizes(size_t(1) << _hash.bits, 0);
+	for (auto const& id: _ids)
+		bucketSizes[_hash.bucket(id)]++;
+
+	SelectorCost cost;
+	// table tag and one push2 <tag> per bucket
+	cost.size = c_jumpTableDispatchSize + 1 + 3 * bucketSizes.size();
+	// dispatch and jumpdest of the bucket
+	cost.gas = (c_jumpTableDispatchGas + 1) * _ids.size();
+	for (size_t bucketSize: bucketSizes)
+		if (bucketSize > 0)
+		{
+			cost.gas += c_selectorComparisonGas * bucketSize * (bucketSize + 1) / 2;
+			// jumpdest, comparisons, push2 <notfound> jump
+			cost.size += 1 + c_selectorComparisonSize * bucketSize + 4;
+		}
+	return cost;
+}
+
+}
+
+size_t ContractCompiler::SelectorHash::bucket(FixedHash<4> const& _id) const
+{
+	uint32_t product = FixedHash<4>::Arith(_id).convert_to<uint32_t>() * multiplier;
+	return product >> (32 - bits);
+}
+
+boost::optional<ContractCompiler::SelectorHash> ContractCompiler::cheaperJumpTableSelector(
+	vector<FixedHash<4>> const& _ids,
+	size_t _runs
+)
+{
+	// The fixed overhead of the jump table is not worth it for small contracts.
+	if (_ids.size() <= 16)
+		return boost::none;
+
+	// Costs over the lifetime of the contract, multiplied by the number of functions.
+	auto totalCost = [&](SelectorCost const& _cost) {
+		return bigint(_runs) * _cost.gas + bigint(_ids.size()) * eth::GasCosts::createDataGas * _cost.size;
+	};
+	SelectorCost splitCost;
+	addSplitSelectorCost(_ids.size(), _runs, splitCost);
+	bigint bestCost = totalCost(splitCost);
+	boost::optional<SelectorHash> best;
+
+	unsigned minBits = 1;
+	while ((size_t(1) << minBits) < _ids.size())
+		minBits++;
+	// Deterministic sequence of odd multipliers, since the output has to be reproducible.
+	uint32_t multiplier = 0x9e3779b9;
+	for (unsigned bits = minBits; bits <= minBits + 2 && bits < 32; ++bits)
+		for (size_t attempt = 0; attempt < 64; ++attempt)
+		{
+			multiplier = multiplier * 1664525 + 1013904223;
+			SelectorHash hash{multiplier | 1, bits};
+			bigint cost = totalCost(jumpTableSelectorCost(hash, _ids));
+			if (cost < bestCost)
+			{
+				bestCost = cost;
+				best = hash;
+			}
+		}
+	return best;
 }
 
 void ContractCompiler::compileContract(
@@ -301,16 +532,7 @@ void ContractCompiler::appendInternalSelector(
 	// Which also means that the execution itself is not profitable
 	// unless we have at least 5 functions.
 
-	// Start with some comparisons to avoid overflow, then do the actual comparison.
-	bool split = false;
-	if (_ids.size() <= 4)
-		split = false;
-	else if (_runs > (17 * eth::GasCosts::createDataGas) / 6)
-		split = true;
-	else
-		split = (_runs * 6 * (_ids.size() - 4) > 17 * eth::GasCosts::createDataGas);
-
-	if (split)
+	if (splitSelector(_ids.size(), _runs))
 	{
 		size_t pivotIndex = _ids.size() / 2;
 		FixedHash<4> pivot{_ids.at(pivotIndex)};
@@ -335,6 +557,65 @@ void ContractCompiler::appendInternalSelector(
 	}
 }
 
+void ContractCompiler::appendJumpTableSelector(
+	map<FixedHash<4>, eth::AssemblyItem const> const& _entryPoints,
+	vector<FixedHash<4>> const& _ids,
+	eth::AssemblyItem const& _notFoundTag,
+	SelectorHash const& _hash
+)
+{
+	// The function IDs are hashed into 2**bits buckets. The table consists of one
+	// push <tag> item per bucket, placed in unreachable code. An entry points either
+	// to a block that compares the function ID with the IDs in that bucket or,
+	// for empty buckets, to the not found tag. Since the tags are pushed by regular
+	// assembly items, the optimiser keeps them and updates them if blocks are merged.
+	// The number of bytes per tag is only known after assembly, so it is read from the
+	// push opcode of the first entry.
+	vector<vector<FixedHash<4>>> buckets(size_t(1) << _hash.bits);
+	for (auto const& id: _ids)
+		buckets[_hash.bucket(id)].emplace_back(id);
+	vector<eth::AssemblyItem> bucketTags;
+	for (auto const& bucket: buckets)
+		bucketTags.emplace_back(bucket.empty() ? _notFoundTag : m_context.newTag());
+	eth::AssemblyItem table = m_context.newTag();
+
+	// stack: <funhash>
+	m_context << Instruction::DUP1 << u256(_hash.multiplier) << Instruction::MUL;
+	m_context << u256(0xffffffff) << Instruction::AND;
+	CompilerUtils(m_context).rightShiftNumberOnStack(32 - _hash.bits);
+	// stack: <funhash> <bucket>
+	m_context << u256(1) << table.pushTag() << Instruction::ADD;
+	m_context << u256(32) << Instruction::DUP2 << u256(0) << Instruction::CODECOPY;
+	m_context << u256(0) << Instruction::MLOAD << u256(0) << Instruction::BYTE;
+	m_context << u256(uint8_t(Instruction::PUSH1) - 1) << Instruction::SWAP1 << Instruction::SUB;
+	// stack: <funhash> <bucket> <entries> <bytes_per_tag>
+	m_context << Instruction::SWAP2 << Instruction::DUP3 << u256(1) << Instruction::ADD;
+	m_context << Instruction::MUL << Instruction::ADD << u256(1) << Instruction::ADD;
+	// stack: <funhash> <bytes_per_tag> <entry_data>
+	// copy the tag into the lower-order bytes of the zeroed scratch space
+	m_context << u256(0) << Instruction::DUP1 << Instruction::MSTORE;
+	m_context << Instruction::DUP2 << Instruction::SWAP1 << Instruction::DUP3 << u256(32) << Instruction::SUB;
+	m_context << Instruction::CODECOPY;
+	m_context << Instruction::POP << u256(0) << Instruction::MLOAD << Instruction::JUMP;
+
+	m_context << table;
+	for (auto const& tag: bucketTags)
+		m_context << tag.pushTag();
+	m_context.adjustStackOffset(-int(bucketTags.size()));
+
+	for (size_t i = 0; i < buckets.size(); ++i)
+		if (!buckets[i].empty())
+		{
+			m_context << bucketTags[i];
+			for (auto const& id: buckets[i])
+			{
+				m_context << dupInstruction(1) << u256(FixedHash<4>::Arith(id)) << Instruction::EQ;
+				m_context.appendConditionalJumpTo(_entryPoints.at(id));
+			}
+			m_context.appendJumpTo(_notFoundTag);
+		}
+}
+
 namespace
 {
 
@@ -393,7 +674,11 @@ void ContractCompiler::appendFunctionSelector(ContractDefinition const& _contrac
 			sortedIDs.emplace_back(it.first);
 		}
 		std::sort(sortedIDs.begin(), sortedIDs.end());
-		appendInternalSelector(callDataUnpackerEntryPoints, sortedIDs, notFound, m_optimiserSettings.expectedExecutionsPerDeployment);
+		size_t runs = m_optimiserSettings.expectedExecutionsPerDeployment;
+		if (auto hash = cheaperJumpTableSelector(sortedIDs, runs))
+			appendJumpTableSelector(callDataUnpackerEntryPoints, sortedIDs, notFound, *hash);
+		else
+			appendInternalSelector(callDataUnpackerEntryPoints, sortedIDs, notFound, runs);
 	}
 
 	m_context << notFound;
@@ -895,7 +1180,12 @@ bool ContractCompiler::visit(EmitStatement const& _emit)
 {
 	CompilerContext::LocationSetter locationSetter(m_context, _emit);
 	StackHeightChecker checker(m_context);
+	bool reuseMemory = reuseTemporaryMemory(_emit.eventCall());
+	if (reuseMemory)
+		CompilerUtils(m_context).fetchFreeMemoryPointer();
 	compileExpression(_emit.eventCall());
+	if (reuseMemory)
+		CompilerUtils(m_context).storeFreeMemoryPointer();
 	checker.check();
 	return false;
 }
@@ -914,6 +1204,12 @@ bool ContractCompiler::visit(VariableDeclarationStatement const& _variableDeclar
 	if (Expression const* expression = _variableDeclarationStatement.initialValue())
 	{
 		CompilerUtils utils(m_context);
+		bool reuseMemory = reuseTemporaryMemory(*expression);
+		for (auto const& declaration: _variableDeclarationStatement.declarations())
+			if (declaration && isMemoryReference(*declaration->annotation().type))
+				reuseMemory = false;
+		if (reuseMemory)
+			utils.fetchFreeMemoryPointer();
 		compileExpression(*expression);
 		TypePointers valueTypes;
 		if (auto tupleType = dynamic_cast<TupleType const*>(expression->annotation().type))
@@ -934,6 +1230,8 @@ bool ContractCompiler::visit(VariableDeclarationStatement const& _variableDeclar
 			else
 				utils.popStackElement(*valueTypes[j]);
 		}
+		if (reuseMemory)
+			utils.storeFreeMemoryPointer();
 	}
 	checker.check();
 	return false;
@@ -944,8 +1242,13 @@ bool ContractCompiler::visit(ExpressionStatement const& _expressionStatement)
 	StackHeightChecker checker(m_context);
 	CompilerContext::LocationSetter locationSetter(m_context, _expressionStatement);
 	Expression const& expression = _expressionStatement.expression();
+	bool reuseMemory = reuseTemporaryMemory(expression);
+	if (reuseMemory)
+		CompilerUtils(m_context).fetchFreeMemoryPointer();
 	compileExpression(expression);
 	CompilerUtils(m_context).popStackElement(*expression.annotation().type);
+	if (reuseMemory)
+		CompilerUtils(m_context).storeFreeMemoryPointer();
 	checker.check();
 	return false;
 }
@@ -1069,6 +1372,15 @@ void ContractCompiler::compileExpression(Expression const& _expression, TypePoin
 		CompilerUtils(m_context).convertType(*_expression.annotation().type, *_targetType);
 }
 
+bool ContractCompiler::reuseTemporaryMemory(Expression const& _expression) const
+{
+	// Outside of loops, resetting the free memory pointer costs more than it is likely to save.
+	return
+		m_optimiserSettings.reuseTemporaryMemory &&
+		!m_breakTags.empty() &&
+		TemporaryMemoryChecker::onlyTemporaryAllocations(_expression);
+}
+
 void ContractCompiler::popScopedVariables(ASTNode const* _node)
 {
 	unsigned blockHeight = m_scopeStackHeight.at(m_modifierDepth).at(_node);
@@ -25,6 +25,9 @@
 #include <libsolidity/ast/ASTVisitor.h>
 #include <libsolidity/codegen/CompilerContext.h>
 #include <libevmasm/Assembly.h>
+
+#include <boost/optional.hpp>
+
 #include <functional>
 #include <ostream>
 
@@ -40,6 +43,15 @@ namespace solidity
 class ContractCompiler: private ASTConstVisitor
 {
 public:
+	/// Multiplicative hash of function IDs into 2**bits buckets.
+	struct SelectorHash
+	{
+		uint32_t multiplier;
+		unsigned bits;
+		/// @returns ((_id * multiplier) mod 2**32) / 2**(32 - bits)
+		size_t bucket(FixedHash<4> const& _id) const;
+	};
+
 	explicit ContractCompiler(
 		ContractCompiler* _runtimeCompiler,
 		CompilerContext& _context,
@@ -94,6 +106,21 @@ private:
 		eth::AssemblyItem const& _notFoundTag,
 		size_t _runs
 	);
+	/// @returns the hash of a jump table based function selector if its cost is lower than
+	/// the cost of a binary split selector over the sorted function IDs @a _ids,
+	/// according to the expected number of executions @a _runs.
+	static boost::optional<SelectorHash> cheaperJumpTableSelector(
+		std::vector<FixedHash<4>> const& _ids,
+		size_t _runs
+	);
+	/// Appends a function selector that jumps through a table indexed by a hash of the
+	/// function ID, followed by comparisons with the IDs that have the same hash.
+	void appendJumpTableSelector(
+		std::map<FixedHash<4>, eth::AssemblyItem const> const& _entryPoints,
+		std::vector<FixedHash<4>> const& _ids,
+		eth::AssemblyItem const& _notFoundTag,
+		SelectorHash const& _hash
+	);
 	void appendFunctionSelector(ContractDefinition const& _contract);
 	void appendCallValueCheck();
 	void appendReturnValuePacker(TypePointers const& _typeParameters, bool _isLibrary);
@@ -127,6 +154,10 @@ private:
 
 	void appendStackVariableInitialisation(VariableDeclaration const& _variable);
 	void compileExpression(Expression const& _expression, TypePointer const& _targetType = TypePointer());
+	/// @returns true if the free memory pointer should be reset after a statement inside a loop
+	/// that evaluates @a _expression and discards its value or stores it in variables that are
+	/// not memory references.
+	bool reuseTemporaryMemory(Expression const& _expression) const;
 
 	/// Frees the variables of a certain scope (to be used when leaving).
 	void popScopedVariables(ASTNode const* _node);
@@ -179,39 +179,10 @@ void StorageItem::retrieveValue(SourceLocation const&, bool _remove) const
 		m_context << Instruction::POP << Instruction::SLOAD;
 	else
 	{
-		bool cleaned = false;
 		m_context
 			<< Instruction::SWAP1 << Instruction::SLOAD << Instruction::SWAP1
-			<< u256(0x100) << Instruction::EXP << Instruction::SWAP1 << Instruction::DIV;
-		if (m_dataType->category() == Type::Category::FixedPoint)
-			// implementation should be very similar to the integer case.
-			solUnimplemented("Not yet implemented - FixedPointType.");
-		if (m_dataType->category() == Type::Category::FixedBytes)
-		{
-			CompilerUtils(m_context).leftShiftNumberOnStack(256 - 8 * m_dataType->storageBytes());
-			cleaned = true;
-		}
-		else if (
-			m_dataType->category() == Type::Category::Integer &&
-			dynamic_cast<IntegerType const&>(*m_dataType).isSigned()
-		)
-		{
-			m_context << u256(m_dataType->storageBytes() - 1) << Instruction::SIGNEXTEND;
-			cleaned = true;
-		}
-		else if (FunctionType const* fun = dynamic_cast<decltype(fun)>(m_dataType))
-		{
-			if (fun->kind() == FunctionType::Kind::External)
-			{
-				CompilerUtils(m_context).splitExternalFunctionType(false);
-				cleaned = true;
-			}
-		}
-		if (!cleaned)
-		{
-			solAssert(m_dataType->sizeOnStack() == 1, "");
-			m_context << ((u256(0x1) << (8 * m_dataType->storageBytes())) - 1) << Instruction::AND;
-		}
+			<< u256(0x100) << Instruction::EXP;
+		unpackFromSlot();
 	}
 }
 
@@ -255,28 +226,7 @@ void StorageItem::storeValue(Type const& _sourceType, SourceLocation const& _loc
 			// stack: value storage_ref cleared_value multiplier
 			utils.copyToStackTop(3 + m_dataType->sizeOnStack(), m_dataType->sizeOnStack());
 			// stack: value storage_ref cleared_value multiplier value
-			if (FunctionType const* fun = dynamic_cast<decltype(fun)>(m_dataType))
-			{
-				solAssert(_sourceType == *m_dataType, "function item stored but target is not equal to source");
-				if (fun->kind() == FunctionType::Kind::External)
-					// Combine the two-item function type into a single stack slot.
-					utils.combineExternalFunctionType(false);
-				else
-					m_context <<
-						((u256(1) << (8 * m_dataType->storageBytes())) - 1) <<
-						Instruction::AND;
-			}
-			else if (m_dataType->category() == Type::Category::FixedBytes)
-			{
-				solAssert(_sourceType.category() == Type::Category::FixedBytes, "source not fixed bytes");
-				CompilerUtils(m_context).rightShiftNumberOnStack(256 - 8 * dynamic_cast<FixedBytesType const&>(*m_dataType).numBytes());
-			}
-			else
-			{
-				solAssert(m_dataType->sizeOnStack() == 1, "Invalid stack size for opaque type.");
-				// remove the higher order bits
-				utils.convertType(_sourceType, *m_dataType, true, true);
-			}
+			packForSlot(_sourceType);
 			m_context  << Instruction::MUL << Instruction::OR;
 			// stack: value storage_ref updated_value
 			m_context << Instruction::SWAP1 << Instruction::SSTORE;
@@ -311,39 +261,71 @@ void StorageItem::storeValue(Type const& _sourceType, SourceLocation const& _loc
 				"Struct assignment with conversion."
 			);
 			solAssert(sourceType.location() != DataLocation::CallData, "Structs in calldata not supported.");
-			for (auto const& member: structType.members(nullptr))
+			// stack layout: source_ref target_ref [slot_value]
+			auto retrieveSourceMember = [&](string const& _name, unsigned _sourceRefDepth) -> TypePointer
 			{
-				// assign each member that is not a mapping
-				TypePointer const& memberType = member.type;
-				if (memberType->category() == Type::Category::Mapping)
-					continue;
-				TypePointer sourceMemberType = sourceType.memberType(member.name);
+				TypePointer sourceMemberType = sourceType.memberType(_name);
 				if (sourceType.location() == DataLocation::Storage)
 				{
-					// stack layout: source_ref target_ref
-					pair<u256, unsigned> const& offsets = sourceType.storageOffsetsOfMember(member.name);
-					m_context << offsets.first << Instruction::DUP3 << Instruction::ADD;
+					pair<u256, unsigned> const& offsets = sourceType.storageOffsetsOfMember(_name);
+					m_context << offsets.first << dupInstruction(_sourceRefDepth + 1) << Instruction::ADD;
 					m_context << u256(offsets.second);
-					// stack: source_ref target_ref source_member_ref source_member_off
+					// stack: source_ref target_ref [slot_value] source_member_ref source_member_off
 					StorageItem(m_context, *sourceMemberType).retrieveValue(_location, true);
-					// stack: source_ref target_ref source_value...
 				}
 				else
 				{
 					solAssert(sourceType.location() == DataLocation::Memory, "");
-					// stack layout: source_ref target_ref
-					TypePointer sourceMemberType = sourceType.memberType(member.name);
-					m_context << sourceType.memoryOffsetOfMember(member.name);
-					m_context << Instruction::DUP3 << Instruction::ADD;
+					m_context << sourceType.memoryOffsetOfMember(_name);
+					m_context << dupInstruction(_sourceRefDepth + 1) << Instruction::ADD;
 					MemoryItem(m_context, *sourceMemberType).retrieveValue(_location, true);
-					// stack layout: source_ref target_ref source_value...
 				}
-				unsigned stackSize = sourceMemberType->sizeOnStack();
-				pair<u256, unsigned> const& offsets = structType.storageOffsetsOfMember(member.name);
-				m_context << dupInstruction(1 + stackSize) << offsets.first << Instruction::ADD;
-				m_context << u256(offsets.second);
-				// stack: source_ref target_ref target_off source_value... target_member_ref target_member_byte_off
-				StorageItem(m_context, *memberType).storeValue(*sourceMemberType, _location, true);
+				// stack: source_ref target_ref [slot_value] source_value...
+				return sourceMemberType;
+			};
+			auto isPacked = [](TypePointer const& _type) {
+				return _type->isValueType() && _type->storageBytes() < 32;
+			};
+			auto const& members = structType.members(nullptr);
+			for (auto it = members.begin(); it != members.end();)
+			{
+				// assign each member that is not a mapping
+				TypePointer const& memberType = it->type;
+				pair<u256, unsigned> const& offsets = structType.storageOffsetsOfMember(it->name);
+				if (memberType->category() == Type::Category::Mapping)
+					++it;
+				else if (isPacked(memberType))
+				{
+					// All members sharing this slot are packed value types and the whole slot
+					// belongs to the struct, so its new content is assembled on the stack
+					// and stored at once instead of updating it member by member.
+					u256 slot = offsets.first;
+					m_context << u256(0);
+					for (; it != members.end(); ++it)
+					{
+						TypePointer const& packedType = it->type;
+						pair<u256, unsigned> const& packedOffsets = structType.storageOffsetsOfMember(it->name);
+						if (!isPacked(packedType) || packedOffsets.first != slot)
+							break;
+						TypePointer sourceMemberType = retrieveSourceMember(it->name, 3);
+						StorageItem(m_context, *packedType).packForSlot(*sourceMemberType);
+						if (packedOffsets.second > 0)
+							m_context << (u256(1) << (8 * packedOffsets.second)) << Instruction::MUL;
+						m_context << Instruction::OR;
+						// stack: source_ref target_ref slot_value
+					}
+					m_context << Instruction::DUP2 << slot << Instruction::ADD << Instruction::SSTORE;
+				}
+				else
+				{
+					TypePointer sourceMemberType = retrieveSourceMember(it->name, 2);
+					unsigned stackSize = sourceMemberType->sizeOnStack();
+					m_context << dupInstruction(1 + stackSize) << offsets.first << Instruction::ADD;
+					m_context << u256(offsets.second);
+					// stack: source_ref target_ref target_off source_value... target_member_ref target_member_byte_off
+					StorageItem(m_context, *memberType).storeValue(*sourceMemberType, _location, true);
+					++it;
+				}
 			}
 			// stack layout: source_ref target_ref
 			solAssert(sourceType.sizeOnStack() == 1, "Unexpected source size.");
@@ -371,9 +353,8 @@ void StorageItem::setToZero(SourceLocation const&, bool _removeReference) const
 	else if (m_dataType->category() == Type::Category::Struct)
 	{
 		// stack layout: storage_key storage_offset
-		// @todo this can be improved: use StorageItem for non-value types, and just store 0 in
-		// all slots that contain value types later.
 		auto const& structType = dynamic_cast<StructType const&>(*m_dataType);
+		set<u256> clearedSlots;
 		for (auto const& member: structType.members(nullptr))
 		{
 			// zero each member that is not a mapping
@@ -381,6 +362,16 @@ void StorageItem::setToZero(SourceLocation const&, bool _removeReference) const
 			if (memberType->category() == Type::Category::Mapping)
 				continue;
 			pair<u256, unsigned> const& offsets = structType.storageOffsetsOfMember(member.name);
+			if (memberType->isValueType())
+			{
+				// Slots containing value types belong to the struct as a whole,
+				// so they are cleared at once instead of member by member.
+				if (clearedSlots.insert(offsets.first).second)
+					m_context
+						<< u256(0) << offsets.first << Instruction::DUP4 << Instruction::ADD
+						<< Instruction::SSTORE;
+				continue;
+			}
 			m_context
 				<< offsets.first << Instruction::DUP3 << Instruction::ADD
 				<< u256(offsets.second);
@@ -419,6 +410,70 @@ void StorageItem::setToZero(SourceLocation const&, bool _removeReference) const
 	}
 }
 
+void StorageItem::unpackFromSlot() const
+{
+	solAssert(m_dataType->isValueType() && m_dataType->storageBytes() < 32, "");
+	// stack: slot_value multiplier
+	m_context << Instruction::SWAP1 << Instruction::DIV;
+	bool cleaned = false;
+	if (m_dataType->category() == Type::Category::FixedPoint)
+		// implementation should be very similar to the integer case.
+		solUnimplemented("Not yet implemented - FixedPointType.");
+	if (m_dataType->category() == Type::Category::FixedBytes)
+	{
+		CompilerUtils(m_context).leftShiftNumberOnStack(256 - 8 * m_dataType->storageBytes());
+		cleaned = true;
+	}
+	else if (
+		m_dataType->category() == Type::Category::Integer &&
+		dynamic_cast<IntegerType const&>(*m_dataType).isSigned()
+	)
+	{
+		m_context << u256(m_dataType->storageBytes() - 1) << Instruction::SIGNEXTEND;
+		cleaned = true;
+	}
+	else if (FunctionType const* fun = dynamic_cast<decltype(fun)>(m_dataType))
+	{
+		if (fun->kind() == FunctionType::Kind::External)
+		{
+			CompilerUtils(m_context).splitExternalFunctionType(false);
+			cleaned = true;
+		}
+	}
+	if (!cleaned)
+	{
+		solAssert(m_dataType->sizeOnStack() == 1, "");
+		m_context << ((u256(0x1) << (8 * m_dataType->storageBytes())) - 1) << Instruction::AND;
+	}
+}
+
+void StorageItem::packForSlot(Type const& _sourceType) const
+{
+	solAssert(m_dataType->isValueType() && m_dataType->storageBytes() < 32, "");
+	if (FunctionType const* fun = dynamic_cast<decltype(fun)>(m_dataType))
+	{
+		solAssert(_sourceType == *m_dataType, "function item stored but target is not equal to source");
+		if (fun->kind() == FunctionType::Kind::External)
+			// Combine the two-item function type into a single stack slot.
+			CompilerUtils(m_context).combineExternalFunctionType(false);
+		else
+			m_context <<
+				((u256(1) << (8 * m_dataType->storageBytes())) - 1) <<
+				Instruction::AND;
+	}
+	else if (m_dataType->category() == Type::Category::FixedBytes)
+	{
+		solAssert(_sourceType.category() == Type::Category::FixedBytes, "source not fixed bytes");
+		CompilerUtils(m_context).rightShiftNumberOnStack(256 - 8 * dynamic_cast<FixedBytesType const&>(*m_dataType).numBytes());
+	}
+	else
+	{
+		solAssert(m_dataType->sizeOnStack() == 1, "Invalid stack size for opaque type.");
+		// remove the higher order bits
+		CompilerUtils(m_context).convertType(_sourceType, *m_dataType, true, true);
+	}
+}
+
 StorageByteArrayElement::StorageByteArrayElement(CompilerContext& _compilerContext):
 	LValue(_compilerContext, TypeProvider::byte())
 {
@@ -147,6 +147,17 @@ public:
 		langutil::SourceLocation const& _location = {},
 		bool _removeReference = true
 	) const override;
+
+	/// Extracts a value of this (packed value) type from the contents of a storage slot.
+	/// Stack pre: slot_value multiplier
+	/// Stack post: value...
+	/// where the multiplier is 0x100**byte_offset.
+	void unpackFromSlot() const;
+	/// Converts a value of type @a _sourceType to the cleaned right-aligned bits it occupies
+	/// as this (packed value) type inside a storage slot.
+	/// Stack pre: value...
+	/// Stack post: packed_value
+	void packForSlot(Type const& _sourceType) const;
 };
 
 /**
@@ -23,6 +23,8 @@
 
 #include <liblangutil/Exceptions.h>
 
+#include <libdevcore/Common.h>
+
 #include <boost/algorithm/string/join.hpp>
 #include <boost/range/adaptor/reversed.hpp>
 
@@ -41,12 +43,59 @@ string MultiUseYulFunctionCollector::requestedFunctions()
 
 string MultiUseYulFunctionCollector::createFunction(string const& _name, function<string ()> const& _creator)
 {
+	if (!m_functionsBeingCreated.empty())
+		m_functionsBeingCreated.back().second.push_back(_name);
 	if (!m_requestedFunctions.count(_name))
 	{
-		string fun = _creator();
-		solAssert(!fun.empty(), "");
-		solAssert(fun.find("function " + _name) != string::npos, "Function not properly named.");
-		m_requestedFunctions[_name] = std::move(fun);
+		if (!m_cache)
+		{
+			string fun = _creator();
+			solAssert(!fun.empty(), "");
+			solAssert(fun.find("function " + _name) != string::npos, "Function not properly named.");
+			m_requestedFunctions[_name] = std::move(fun);
+		}
+		else if (auto cached = m_cache->find(_name))
+			addCachedFunction(_name, *cached);
+		else
+		{
+			m_functionsBeingCreated.emplace_back(_name, vector<string>{});
+			ScopeGuard popFunction([&]() { m_functionsBeingCreated.pop_back(); });
+			auto fun = make_shared<MultiUseYulFunctionCache::Function>();
+			fun->code = _creator();
+			fun->dependencies = std::move(m_functionsBeingCreated.back().second);
+			solAssert(!fun->code.empty(), "");
+			solAssert(fun->code.find("function " + _name) != string::npos, "Function not properly named.");
+			m_requestedFunctions[_name] = fun->code;
+			m_cache->store(_name, std::move(fun));
+		}
 	}
 	return _name;
 }
+
+void MultiUseYulFunctionCollector::addCachedFunction(
+	string const& _name,
+	MultiUseYulFunctionCache::Function const& _function
+)
+{
+	m_requestedFunctions[_name] = _function.code;
+	for (string const& dependency: _function.dependencies)
+		if (!m_requestedFunctions.count(dependency))
+		{
+			auto cached = m_cache->find(dependency);
+			solAssert(cached, "Dependency of cached function not cached.");
+			addCachedFunction(dependency, *cached);
+		}
+}
+
+shared_ptr<MultiUseYulFunctionCache::Function const> MultiUseYulFunctionCache::find(string const& _name) const
+{
+	lock_guard<mutex> lock(m_mutex);
+	auto it = m_functions.find(_name);
+	return it == m_functions.end() ? nullptr : it->second;
+}
+
+void MultiUseYulFunctionCache::store(string const& _name, shared_ptr<Function const> _function)
+{
+	lock_guard<mutex> lock(m_mutex);
+	m_functions.emplace(_name, std::move(_function));
+}
@@ -23,13 +23,41 @@
 
 #include <functional>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace dev
 {
 namespace solidity
 {
 
+/**
+ * Cache of generated Yul functions that can be shared between the function collectors of
+ * several contracts, so that a function is generated only once per compilation.
+ * Only functions whose code is fully determined by their name may be cached.
+ */
+class MultiUseYulFunctionCache
+{
+public:
+	struct Function
+	{
+		std::string code;
+		/// Names of the functions requested while generating this function.
+		std::vector<std::string> dependencies;
+	};
+
+	/// @returns the function stored under @a _name or nullptr if there is none.
+	std::shared_ptr<Function const> find(std::string const& _name) const;
+	void store(std::string const& _name, std::shared_ptr<Function const> _function);
+
+private:
+	mutable std::mutex m_mutex;
+	std::map<std::string, std::shared_ptr<Function const>> m_functions;
+};
+
 /**
  * Container of (unparsed) Yul functions identified by name which are meant to be generated
  * only once.
@@ -37,6 +65,11 @@ namespace solidity
 class MultiUseYulFunctionCollector
 {
 public:
+	/// @param _cache if given, functions are taken from and added to this cache.
+	explicit MultiUseYulFunctionCollector(std::shared_ptr<MultiUseYulFunctionCache> _cache = nullptr):
+		m_cache(std::move(_cache))
+	{}
+
 	/// Helper function that uses @a _creator to create a function and add it to
 	/// @a m_requestedFunctions if it has not been created yet and returns @a _name in both
 	/// cases.
@@ -48,8 +81,15 @@ public:
 	std::string requestedFunctions();
 
 private:
+	/// Adds the cached function @a _name and, recursively, its dependencies.
+	void addCachedFunction(std::string const& _name, MultiUseYulFunctionCache::Function const& _function);
+
 	/// Map from function name to code for a multi-use function.
 	std::map<std::string, std::string> m_requestedFunctions;
+	std::shared_ptr<MultiUseYulFunctionCache> m_cache;
+	/// Functions whose creators are currently running, together with the names of the
+	/// functions they requested so far. Only used together with the cache.
+	std::vector<std::pair<std::string, std::vector<std::string>>> m_functionsBeingCreated;
 };
 
 }
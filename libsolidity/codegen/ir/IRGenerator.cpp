@@ -43,30 +43,59 @@ using namespace std;
 using namespace dev;
 using namespace dev::solidity;
 
-pair<string, string> IRGenerator::run(ContractDefinition const& _contract)
+namespace
+{
+
+string const c_warning =
+	"/*******************************************************\n"
+	" *                       WARNING                       *\n"
+	" *  Solidity to Yul compilation is still EXPERIMENTAL  *\n"
+	" *       It can result in LOSS OF FUNDS or worse       *\n"
+	" *                !USE AT YOUR OWN RISK!               *\n"
+	" *******************************************************/\n\n";
+
+}
+
+IRGenerator::~IRGenerator() = default;
+
+string IRGenerator::run(ContractDefinition const& _contract)
 {
 	// TODO Would be nice to pretty-print this while retaining comments.
-	string ir = generate(_contract);
+	string ir = c_warning + generate(_contract);
+
+#ifndef NDEBUG
+	// The parsed code is kept, so that it does not have to be parsed again for optimization.
+	m_parsedIR = parse(ir, m_evmVersion, m_optimiserSettings);
+#endif
 
-	yul::AssemblyStack asmStack(m_evmVersion, yul::AssemblyStack::Language::StrictAssembly, m_optimiserSettings);
-	if (!asmStack.parseAndAnalyze("", ir))
+	return ir;
+}
+
+unique_ptr<yul::AssemblyStack> IRGenerator::parse(
+	string const& _ir,
+	langutil::EVMVersion _evmVersion,
+	OptimiserSettings const& _optimiserSettings
+)
+{
+	auto asmStack = make_unique<yul::AssemblyStack>(
+		_evmVersion,
+		yul::AssemblyStack::Language::StrictAssembly,
+		_optimiserSettings
+	);
+	if (!asmStack->parseAndAnalyze("", _ir))
 	{
 		string errorMessage;
-		for (auto const& error: asmStack.errors())
+		for (auto const& error: asmStack->errors())
 			errorMessage += langutil::SourceReferenceFormatter::formatErrorInformation(*error);
-		solAssert(false, "Invalid IR generated:\n" + errorMessage + "\n" + ir);
+		solAssert(false, "Invalid IR generated:\n" + errorMessage + "\n" + _ir);
 	}
-	asmStack.optimize();
-
-	string warning =
-		"/*******************************************************\n"
-		" *                       WARNING                       *\n"
-		" *  Solidity to Yul compilation is still EXPERIMENTAL  *\n"
-		" *       It can result in LOSS OF FUNDS or worse       *\n"
-		" *                !USE AT YOUR OWN RISK!               *\n"
-		" *******************************************************/\n\n";
+	return asmStack;
+}
 
-	return {warning + ir, warning + asmStack.print()};
+string IRGenerator::optimize(yul::AssemblyStack& _stack)
+{
+	_stack.optimize();
+	return c_warning + _stack.print();
 }
 
 string IRGenerator::generate(ContractDefinition const& _contract)
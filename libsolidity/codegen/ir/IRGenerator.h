@@ -27,8 +27,15 @@
 #include <libsolidity/codegen/ir/IRGenerationContext.h>
 #include <libsolidity/codegen/YulUtilFunctions.h>
 #include <liblangutil/EVMVersion.h>
+
+#include <memory>
 #include <string>
 
+namespace yul
+{
+class AssemblyStack;
+}
+
 namespace dev
 {
 namespace solidity
@@ -46,9 +53,24 @@ public:
 		m_utils(_evmVersion, m_context.functionCollector())
 	{}
 
-	/// Generates and returns the IR code, in unoptimized and optimized form
+	~IRGenerator();
+
+	/// Generates and returns the IR code in unoptimized form.
+	/// In debug builds, the code is also parsed and analysed to assert that it is valid.
+	std::string run(ContractDefinition const& _contract);
+	/// @returns the code generated by the last call to run() in parsed and analysed form,
+	/// or nullptr if run() did not parse it.
+	std::unique_ptr<yul::AssemblyStack> takeParsedIR() { return std::move(m_parsedIR); }
+
+	/// Parses and analyses the IR code @a _ir returned by run().
+	static std::unique_ptr<yul::AssemblyStack> parse(
+		std::string const& _ir,
+		langutil::EVMVersion _evmVersion,
+		OptimiserSettings const& _optimiserSettings
+	);
+	/// Optimizes the parsed IR code in @a _stack in place and @returns it in printed form
 	/// (or just pretty-printed, depending on the optimizer settings).
-	std::pair<std::string, std::string> run(ContractDefinition const& _contract);
+	static std::string optimize(yul::AssemblyStack& _stack);
 
 private:
 	std::string generate(ContractDefinition const& _contract);
@@ -75,6 +97,7 @@ private:
 
 	IRGenerationContext m_context;
 	YulUtilFunctions m_utils;
+	std::unique_ptr<yul::AssemblyStack> m_parsedIR;
 };
 
 }
@@ -21,6 +21,7 @@
 #include <libsolidity/formal/SMTPortfolio.h>
 #include <libsolidity/formal/SymbolicTypes.h>
 
+#include <libdevcore/Parallel.h>
 #include <libdevcore/StringUtils.h>
 
 #include <boost/range/adaptor/map.hpp>
@@ -28,13 +29,17 @@
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/optional.hpp>
 
+#include <tuple>
+
 using namespace std;
 using namespace dev;
 using namespace langutil;
 using namespace dev::solidity;
 
-SMTChecker::SMTChecker(ErrorReporter& _errorReporter, map<h256, string> const& _smtlib2Responses):
+SMTChecker::SMTChecker(ErrorReporter& _errorReporter, map<h256, string> const& _smtlib2Responses, unsigned _jobs):
 	m_interface(make_shared<smt::SMTPortfolio>(_smtlib2Responses)),
+	m_smtlib2Responses(_smtlib2Responses),
+	m_jobs(_jobs),
 	m_errorReporterReference(_errorReporter),
 	m_errorReporter(m_smtErrors),
 	m_context(*m_interface)
@@ -54,13 +59,18 @@ void SMTChecker::analyze(SourceUnit const& _source, shared_ptr<Scanner> const& _
 {
 	m_scanner = _scanner;
 	if (_source.annotation().experimentalFeatures.count(ExperimentalFeature::SMTChecker))
-		_source.accept(*this);
+	{
+		if (m_jobs == 1)
+			_source.accept(*this);
+		else
+			analyzeConcurrently(_source);
+	}
 
 	solAssert(m_interface->solvers() > 0, "");
 	// If this check is true, Z3 and CVC4 are not available
 	// and the query answers were not provided, since SMTPortfolio
 	// guarantees that SmtLib2Interface is the first solver.
-	if (!m_interface->unhandledQueries().empty() && m_interface->solvers() == 1)
+	if (!unhandledQueries().empty() && m_interface->solvers() == 1)
 	{
 		if (!m_noSolverWarning)
 		{
@@ -76,13 +86,74 @@ void SMTChecker::analyze(SourceUnit const& _source, shared_ptr<Scanner> const& _
 	m_errorReporter.clear();
 }
 
+vector<string> SMTChecker::unhandledQueries()
+{
+	return m_interface->unhandledQueries() + m_workerUnhandledQueries;
+}
+
+void SMTChecker::analyzeConcurrently(SourceUnit const& _source)
+{
+	// Every root function is encoded from scratch (see visit(FunctionDefinition)),
+	// so the members of a contract can be checked independently of each other.
+	// Only the first item of a contract reports the unsupported state variables,
+	// since every item creates them.
+	vector<tuple<ContractDefinition const*, ASTNode const*, bool>> items;
+	for (auto const& node: _source.nodes())
+		if (auto contract = dynamic_cast<ContractDefinition const*>(node.get()))
+		{
+			size_t const firstItem = items.size();
+			for (auto const& base: contract->baseContracts())
+				items.emplace_back(contract, base.get(), items.size() == firstItem);
+			for (auto const& subNode: contract->subNodes())
+				items.emplace_back(contract, subNode.get(), items.size() == firstItem);
+		}
+
+	// Each item gets a fresh checker and solver, so that the results
+	// do not depend on how the items are distributed over the threads.
+	vector<ErrorList> errors(items.size());
+	vector<vector<string>> queries(items.size());
+	parallelFor(items.size(), workerCount(items.size(), m_jobs), [&](size_t _index, unsigned)
+	{
+		SMTChecker checker(m_errorReporterReference, m_smtlib2Responses);
+		checker.m_scanner = m_scanner;
+		checker.m_errorReporter.clear();
+		checker.analyzeContractMember(get<0>(items[_index]), get<1>(items[_index]), get<2>(items[_index]));
+		errors[_index] = checker.m_errorReporter.errors();
+		queries[_index] = checker.m_interface->unhandledQueries();
+	});
+
+	for (size_t i = 0; i < items.size(); ++i)
+	{
+		m_errorReporter.append(errors[i]);
+		m_workerUnhandledQueries += queries[i];
+	}
+}
+
+void SMTChecker::analyzeContractMember(
+	ContractDefinition const* _contract,
+	ASTNode const* _node,
+	bool _reportStateVariables
+)
+{
+	createStateVariables(*_contract, _reportStateVariables);
+	_node->accept(*this);
+	endVisit(*_contract);
+}
+
 bool SMTChecker::visit(ContractDefinition const& _contract)
 {
-	for (auto _var : _contract.stateVariables())
-		createVariable(*_var);
+	createStateVariables(_contract, true);
 	return true;
 }
 
+void SMTChecker::createStateVariables(ContractDefinition const& _contract, bool _reportUnsupported)
+{
+	// Inherited state variables are reported when their own contract is visited.
+	for (auto const& contract: _contract.annotation().linearizedBaseContracts)
+		for (auto _var: contract->stateVariables())
+			createVariable(*_var, _reportUnsupported && contract == &_contract);
+}
+
 void SMTChecker::endVisit(ContractDefinition const&)
 {
 	m_variables.clear();
@@ -437,15 +508,73 @@ void SMTChecker::addOverflowTarget(
 
 void SMTChecker::checkUnderOverflow()
 {
+	vector<UnderOverflowCheck> checks;
 	for (auto& target: m_overflowTargets)
 	{
-		swap(m_callStack, target.callStack);
 		if (target.type != OverflowTarget::Type::Overflow)
-			checkUnderflow(target);
+			checks.emplace_back(&target, true);
 		if (target.type != OverflowTarget::Type::Underflow)
+			checks.emplace_back(&target, false);
+	}
+	checkUnderOverflow(checks, 0, checks.size());
+}
+
+void SMTChecker::checkUnderOverflow(vector<UnderOverflowCheck> const& _checks, size_t _begin, size_t _end)
+{
+	if (_begin == _end)
+		return;
+
+	// All targets are checked against the same assertions, so a single unsatisfiable query
+	// proves all of them. This is only worth it if an integrated solver can answer the query,
+	// otherwise it would just be one more unhandled query.
+	if (_end - _begin > 1 && m_interface->solvers() > 1)
+	{
+		smt::Expression anyViolation = underOverflowCondition(*_checks[_begin].first, _checks[_begin].second);
+		for (size_t i = _begin + 1; i < _end; ++i)
+			anyViolation = anyViolation || underOverflowCondition(*_checks[i].first, _checks[i].second);
+
+		m_interface->push();
+		addPathConjoinedExpression(anyViolation);
+		smt::CheckResult result = smt::CheckResult::ERROR;
+		try
+		{
+			result = m_interface->check({}).first;
+		}
+		catch (smt::SolverError const&)
+		{
+			// Errors are reported by the individual checks.
+		}
+		m_interface->pop();
+		if (result == smt::CheckResult::UNSATISFIABLE)
+			return;
+	}
+
+	if (_end - _begin == 1)
+	{
+		OverflowTarget& target = *_checks[_begin].first;
+		swap(m_callStack, target.callStack);
+		if (_checks[_begin].second)
+			checkUnderflow(target);
+		else
 			checkOverflow(target);
 		swap(m_callStack, target.callStack);
 	}
+	else
+	{
+		size_t middle = _begin + (_end - _begin) / 2;
+		checkUnderOverflow(_checks, _begin, middle);
+		checkUnderOverflow(_checks, middle, _end);
+	}
+}
+
+smt::Expression SMTChecker::underOverflowCondition(OverflowTarget const& _target, bool _underflow)
+{
+	auto intType = dynamic_cast<IntegerType const*>(_target.intType);
+	solAssert(intType, "");
+	if (_underflow)
+		return _target.path && _target.value < minValue(*intType);
+	else
+		return _target.path && _target.value > maxValue(*intType);
 }
 
 void SMTChecker::checkUnderflow(OverflowTarget& _target)
@@ -453,7 +582,7 @@ void SMTChecker::checkUnderflow(OverflowTarget& _target)
 	solAssert(_target.type != OverflowTarget::Type::Overflow, "");
 	auto intType = dynamic_cast<IntegerType const*>(_target.intType);
 	checkCondition(
-		_target.path && _target.value < minValue(*intType),
+		underOverflowCondition(_target, true),
 		_target.location,
 		"Underflow (resulting value less than " + formatNumberReadable(intType->minValue()) + ")",
 		"<result>",
@@ -466,7 +595,7 @@ void SMTChecker::checkOverflow(OverflowTarget& _target)
 	solAssert(_target.type != OverflowTarget::Type::Underflow, "");
 	auto intType = dynamic_cast<IntegerType const*>(_target.intType);
 	checkCondition(
-		_target.path && _target.value > maxValue(*intType),
+		underOverflowCondition(_target, false),
 		_target.location,
 		"Overflow (resulting value larger than " + formatNumberReadable(intType->maxValue()) + ")",
 		"<result>",
@@ -1592,7 +1721,7 @@ void SMTChecker::mergeVariables(set<VariableDeclaration const*> const& _variable
 	}
 }
 
-bool SMTChecker::createVariable(VariableDeclaration const& _varDecl)
+bool SMTChecker::createVariable(VariableDeclaration const& _varDecl, bool _reportUnsupported)
 {
 	// This might be the case for multiple calls to the same function.
 	if (knownVariable(_varDecl))
@@ -1603,10 +1732,11 @@ bool SMTChecker::createVariable(VariableDeclaration const& _varDecl)
 	m_variables.emplace(&_varDecl, result.second);
 	if (result.first)
 	{
-		m_errorReporter.warning(
-			_varDecl.location(),
-			"Assertion checker does not yet support the type of this variable."
-		);
+		if (_reportUnsupported)
+			m_errorReporter.warning(
+				_varDecl.location(),
+				"Assertion checker does not yet support the type of this variable."
+			);
 		return false;
 	}
 	return true;
@@ -46,14 +46,21 @@ namespace solidity
 class SMTChecker: private ASTConstVisitor
 {
 public:
-	SMTChecker(langutil::ErrorReporter& _errorReporter, std::map<h256, std::string> const& _smtlib2Responses);
+	/// @param _jobs maximum number of threads used to verify the functions of a source unit
+	/// concurrently, each with its own solver instance. Zero selects the number of hardware
+	/// threads. The reported warnings do not depend on this value.
+	SMTChecker(
+		langutil::ErrorReporter& _errorReporter,
+		std::map<h256, std::string> const& _smtlib2Responses,
+		unsigned _jobs = 1
+	);
 
 	void analyze(SourceUnit const& _sources, std::shared_ptr<langutil::Scanner> const& _scanner);
 
 	/// This is used if the SMT solver is not directly linked into this binary.
 	/// @returns a list of inputs to the SMT solver that were not part of the argument to
 	/// the constructor.
-	std::vector<std::string> unhandledQueries() { return m_interface->unhandledQueries(); }
+	std::vector<std::string> unhandledQueries();
 
 	/// @return the FunctionDefinition of a called function if possible and should inline,
 	/// otherwise nullptr.
@@ -64,6 +71,19 @@ private:
 	// because the order of expression evaluation is undefined
 	// TODO: or just force a certain order, but people might have a different idea about that.
 
+	/// Distributes the members of all contracts in @a _source over m_jobs workers
+	/// and merges their warnings in source order.
+	void analyzeConcurrently(SourceUnit const& _source);
+	/// Encodes and checks @a _node, which is a base specifier or sub-node of @a _contract,
+	/// in the same way as visiting the whole contract would. Unsupported state variables
+	/// are only reported if @a _reportStateVariables is true.
+	/// Used by the workers of analyzeConcurrently.
+	void analyzeContractMember(
+		ContractDefinition const* _contract,
+		ASTNode const* _node,
+		bool _reportStateVariables
+	);
+
 	bool visit(ContractDefinition const& _node) override;
 	void endVisit(ContractDefinition const& _node) override;
 	void endVisit(VariableDeclaration const& _node) override;
@@ -186,8 +206,18 @@ private:
 	/// Checks that the value is in the range given by the type.
 	void checkUnderflow(OverflowTarget& _target);
 	void checkOverflow(OverflowTarget& _target);
+	/// @returns the condition under which the value of @a _target is less than the
+	/// minimum (if @a _underflow is true) or larger than the maximum of its type.
+	smt::Expression underOverflowCondition(OverflowTarget const& _target, bool _underflow);
 	/// Calls the functions above for all elements in m_overflowTargets accordingly.
 	void checkUnderOverflow();
+	/// An underflow (true) or overflow (false) check of an overflow target.
+	using UnderOverflowCheck = std::pair<OverflowTarget*, bool>;
+	/// Checks the elements of @a _checks in the range [_begin, _end) with a single query
+	/// for the disjunction of their conditions. Only if this cannot exclude a violation,
+	/// the range is split and its halves are checked recursively, down to single checks
+	/// which report the result.
+	void checkUnderOverflow(std::vector<UnderOverflowCheck> const& _checks, size_t _begin, size_t _end);
 	/// Adds an overflow target for lazy check at the end of the function.
 	void addOverflowTarget(OverflowTarget::Type _type, TypePointer _intType, smt::Expression _value, langutil::SourceLocation const& _location);
 
@@ -211,8 +241,11 @@ private:
 	/// using the branch condition as guard.
 	void mergeVariables(std::set<VariableDeclaration const*> const& _variables, smt::Expression const& _condition, VariableIndices const& _indicesEndTrue, VariableIndices const& _indicesEndFalse);
 	/// Tries to create an uninitialized variable and returns true on success.
-	/// This fails if the type is not supported.
-	bool createVariable(VariableDeclaration const& _varDecl);
+	/// This fails if the type is not supported, which is reported if @a _reportUnsupported is true.
+	bool createVariable(VariableDeclaration const& _varDecl, bool _reportUnsupported = true);
+	/// Creates the state variables of @a _contract and all its bases. Unsupported types are
+	/// only reported for the variables declared in @a _contract and if @a _reportUnsupported is true.
+	void createStateVariables(ContractDefinition const& _contract, bool _reportUnsupported);
 
 	/// @returns true if _delc is a variable that is known at the current point, i.e.
 	/// has a valid index
@@ -275,6 +308,10 @@ private:
 	std::set<VariableDeclaration const*> touchedVariables(ASTNode const& _node);
 
 	std::shared_ptr<smt::SolverInterface> m_interface;
+	std::map<h256, std::string> m_smtlib2Responses;
+	unsigned m_jobs = 1;
+	/// Queries the solvers of concurrent workers could not answer.
+	std::vector<std::string> m_workerUnhandledQueries;
 	VariableUsage m_variableUsage;
 	bool m_loopExecutionHappened = false;
 	bool m_arrayAssignmentHappened = false;
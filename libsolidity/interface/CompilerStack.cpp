@@ -39,6 +39,7 @@
 #include <libsolidity/ast/AST.h>
 #include <libsolidity/ast/TypeProvider.h>
 #include <libsolidity/codegen/Compiler.h>
+#include <libsolidity/codegen/MultiUseYulFunctionCollector.h>
 #include <libsolidity/formal/SMTChecker.h>
 #include <libsolidity/interface/ABI.h>
 #include <libsolidity/interface/Natspec.h>
@@ -48,20 +49,25 @@
 
 #include <libsolidity/codegen/ir/IRGenerator.h>
 
+#include <libyul/AssemblyStack.h>
 #include <libyul/YulString.h>
 
 #include <liblangutil/Scanner.h>
 #include <liblangutil/SemVerHandler.h>
 
+#include <libevmasm/Assembly.h>
 #include <libevmasm/Exceptions.h>
 
 #include <libdevcore/SwarmHash.h>
 #include <libdevcore/JSON.h>
+#include <libdevcore/Parallel.h>
 
 #include <json/json.h>
 
 #include <boost/algorithm/string.hpp>
 
+#include <array>
+
 using namespace std;
 using namespace dev;
 using namespace langutil;
@@ -151,6 +157,20 @@ void CompilerStack::useMetadataLiteralSources(bool _metadataLiteralSources)
 	m_metadataLiteralSources = _metadataLiteralSources;
 }
 
+void CompilerStack::setSMTCheckerJobs(unsigned _jobs)
+{
+	if (m_stackState >= ParsingSuccessful)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must set SMTChecker jobs before parsing."));
+	m_smtCheckerJobs = _jobs;
+}
+
+void CompilerStack::setAnalysisJobs(unsigned _jobs)
+{
+	if (m_stackState >= ParsingSuccessful)
+		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Must set analysis jobs before parsing."));
+	m_analysisJobs = _jobs;
+}
+
 void CompilerStack::addSMTLib2Response(h256 const& _hash, string const& _response)
 {
 	if (m_stackState >= ParsingSuccessful)
@@ -170,8 +190,11 @@ void CompilerStack::reset(bool _keepSettings)
 		m_libraries.clear();
 		m_evmVersion = langutil::EVMVersion();
 		m_generateIR = false;
+		m_viaIR = false;
 		m_optimiserSettings = OptimiserSettings::minimal();
 		m_metadataLiteralSources = false;
+		m_smtCheckerJobs = 1;
+		m_analysisJobs = 1;
 	}
 	m_globalContext.reset();
 	m_scopes.clear();
@@ -249,15 +272,15 @@ bool CompilerStack::analyze()
 	bool noErrors = true;
 
 	try {
-		SyntaxChecker syntaxChecker(m_errorReporter);
-		for (Source const* source: m_sourceOrder)
-			if (!syntaxChecker.checkSyntax(*source->ast))
-				noErrors = false;
+		if (!analyzeSources([](SourceUnit const& _source, ErrorReporter& _errorReporter) {
+			return SyntaxChecker(_errorReporter).checkSyntax(_source);
+		}))
+			noErrors = false;
 
-		DocStringAnalyser docStringAnalyser(m_errorReporter);
-		for (Source const* source: m_sourceOrder)
-			if (!docStringAnalyser.analyseDocStrings(*source->ast))
-				noErrors = false;
+		if (!analyzeSources([](SourceUnit const& _source, ErrorReporter& _errorReporter) {
+			return DocStringAnalyser(_errorReporter).analyseDocStrings(_source);
+		}))
+			noErrors = false;
 
 		m_globalContext = make_shared<GlobalContext>();
 		NameAndTypeResolver resolver(m_globalContext->declarations(), m_scopes, m_errorReporter);
@@ -309,63 +332,15 @@ bool CompilerStack::analyze()
 		//
 		// Note: this does not resolve overloaded functions. In order to do that, types of arguments are needed,
 		// which is only done one step later.
-		TypeChecker typeChecker(m_evmVersion, m_errorReporter);
-		for (Source const* source: m_sourceOrder)
-			for (ASTPointer<ASTNode> const& node: source->ast->nodes())
-				if (ContractDefinition* contract = dynamic_cast<ContractDefinition*>(node.get()))
-					if (!typeChecker.checkTypeRequirements(*contract))
-						noErrors = false;
+		if (!typeCheckContracts())
+			noErrors = false;
 
-		if (noErrors)
-		{
-			// Checks that can only be done when all types of all AST nodes are known.
-			PostTypeChecker postTypeChecker(m_errorReporter);
-			for (Source const* source: m_sourceOrder)
-				if (!postTypeChecker.check(*source->ast))
-					noErrors = false;
-		}
-
-		if (noErrors)
-		{
-			// Control flow graph generator and analyzer. It can check for issues such as
-			// variable is used before it is assigned to.
-			CFG cfg(m_errorReporter);
-			for (Source const* source: m_sourceOrder)
-				if (!cfg.constructFlow(*source->ast))
-					noErrors = false;
-
-			if (noErrors)
-			{
-				ControlFlowAnalyzer controlFlowAnalyzer(cfg, m_errorReporter);
-				for (Source const* source: m_sourceOrder)
-					if (!controlFlowAnalyzer.analyze(*source->ast))
-						noErrors = false;
-			}
-		}
+		if (noErrors && !runPostTypeCheckingAnalyses())
+			noErrors = false;
 
 		if (noErrors)
 		{
-			// Checks for common mistakes. Only generates warnings.
-			StaticAnalyzer staticAnalyzer(m_errorReporter);
-			for (Source const* source: m_sourceOrder)
-				if (!staticAnalyzer.analyze(*source->ast))
-					noErrors = false;
-		}
-
-		if (noErrors)
-		{
-			// Check for state mutability in every function.
-			vector<ASTPointer<ASTNode>> ast;
-			for (Source const* source: m_sourceOrder)
-				ast.push_back(source->ast);
-
-			if (!ViewPureChecker(ast, m_errorReporter).check())
-				noErrors = false;
-		}
-
-		if (noErrors)
-		{
-			SMTChecker smtChecker(m_errorReporter, m_smtlib2Responses);
+			SMTChecker smtChecker(m_errorReporter, m_smtlib2Responses, m_smtCheckerJobs);
 			for (Source const* source: m_sourceOrder)
 				smtChecker.analyze(*source->ast, source->scanner);
 			m_unhandledSMTLib2Queries += smtChecker.unhandledQueries();
@@ -387,6 +362,198 @@ bool CompilerStack::analyze()
 		return false;
 }
 
+bool CompilerStack::analyzeSources(function<bool(SourceUnit const&, ErrorReporter&)> const& _analysis)
+{
+	vector<ErrorList> errors(m_sourceOrder.size());
+	// Not using vector<bool>, since its elements cannot be written concurrently.
+	vector<char> success(m_sourceOrder.size(), false);
+	vector<char> fatal(m_sourceOrder.size(), false);
+	parallelFor(m_sourceOrder.size(), workerCount(m_sourceOrder.size(), m_analysisJobs), [&](size_t _index, unsigned)
+	{
+		ErrorReporter errorReporter(errors[_index]);
+		try
+		{
+			success[_index] = _analysis(*m_sourceOrder[_index]->ast, errorReporter);
+		}
+		catch (FatalError const&)
+		{
+			fatal[_index] = true;
+		}
+	});
+
+	bool noErrors = true;
+	for (size_t i = 0; i < m_sourceOrder.size(); ++i)
+	{
+		m_errorReporter.append(errors[i]);
+		if (fatal[i])
+			BOOST_THROW_EXCEPTION(FatalError());
+		if (!success[i])
+			noErrors = false;
+	}
+	return noErrors;
+}
+
+bool CompilerStack::runPostTypeCheckingAnalyses()
+{
+	vector<ASTPointer<ASTNode>> ast;
+	for (Source const* source: m_sourceOrder)
+		ast.push_back(source->ast);
+	// The state mutability of modifiers is needed by the checks of all functions invoking them,
+	// which can be in any source.
+	ViewPureChecker::ModifierMutabilities const modifierMutabilities = ViewPureChecker::inferModifierMutability(ast);
+
+	// The analyses, in the order they are reported. Each one only reports errors if all
+	// previous analyses were successful on all sources.
+	enum Analysis { PostTypeChecking, ControlFlow, StaticAnalysis, ViewPureChecking, AnalysisCount };
+	using AnalysisErrors = array<ErrorList, AnalysisCount>;
+	vector<AnalysisErrors> errors(m_sourceOrder.size());
+	// Index of the analysis that raised a fatal error for each source, AnalysisCount if none did.
+	vector<size_t> fatalAnalysis(m_sourceOrder.size(), AnalysisCount);
+
+	parallelFor(m_sourceOrder.size(), workerCount(m_sourceOrder.size(), m_analysisJobs), [&](size_t _index, unsigned)
+	{
+		SourceUnit const& source = *m_sourceOrder[_index]->ast;
+		AnalysisErrors& sourceErrors = errors[_index];
+		try
+		{
+			// The analyses are independent of each other, so they share a single traversal.
+			// The control flow graph of a function is constructed when visiting its definition,
+			// right before it is analyzed.
+			ErrorReporter postTypeReporter(sourceErrors[PostTypeChecking]);
+			ErrorReporter controlFlowReporter(sourceErrors[ControlFlow]);
+			ErrorReporter staticReporter(sourceErrors[StaticAnalysis]);
+			ErrorReporter viewPureReporter(sourceErrors[ViewPureChecking]);
+			PostTypeChecker postTypeChecker(postTypeReporter);
+			CFG cfg(controlFlowReporter);
+			ControlFlowAnalyzer controlFlowAnalyzer(cfg, controlFlowReporter);
+			StaticAnalyzer staticAnalyzer(staticReporter);
+			ViewPureChecker viewPureChecker(modifierMutabilities, viewPureReporter);
+			CompositeASTConstVisitor analyses({
+				&postTypeChecker,
+				&cfg,
+				&controlFlowAnalyzer,
+				&staticAnalyzer,
+				&viewPureChecker
+			});
+			source.accept(analyses);
+			return;
+		}
+		catch (FatalError const&)
+		{
+		}
+
+		// A fatal error aborts the traversal for all analyses. Run them separately to report
+		// exactly the errors of the analyses preceding the fatal one.
+		sourceErrors = AnalysisErrors{};
+		for (size_t analysis = 0; analysis < AnalysisCount; ++analysis)
+		{
+			ErrorReporter errorReporter(sourceErrors[analysis]);
+			try
+			{
+				bool success = false;
+				switch (analysis)
+				{
+				case PostTypeChecking:
+					success = PostTypeChecker(errorReporter).check(source);
+					break;
+				case ControlFlow:
+				{
+					CFG cfg(errorReporter);
+					success = cfg.constructFlow(source) && ControlFlowAnalyzer(cfg, errorReporter).analyze(source);
+					break;
+				}
+				case StaticAnalysis:
+					success = StaticAnalyzer(errorReporter).analyze(source);
+					break;
+				case ViewPureChecking:
+					success = ViewPureChecker(modifierMutabilities, errorReporter).check(source);
+					break;
+				}
+				if (!success)
+					break;
+			}
+			catch (FatalError const&)
+			{
+				fatalAnalysis[_index] = analysis;
+				break;
+			}
+		}
+	});
+
+	for (size_t analysis = 0; analysis < AnalysisCount; ++analysis)
+	{
+		bool noErrors = true;
+		for (size_t i = 0; i < m_sourceOrder.size(); ++i)
+		{
+			m_errorReporter.append(errors[i][analysis]);
+			if (fatalAnalysis[i] == analysis)
+				BOOST_THROW_EXCEPTION(FatalError());
+			if (!Error::containsOnlyWarnings(errors[i][analysis]))
+				noErrors = false;
+		}
+		if (!noErrors)
+			return false;
+	}
+	return true;
+}
+
+bool CompilerStack::typeCheckContracts()
+{
+	vector<ContractDefinition const*> contracts;
+	for (Source const* source: m_sourceOrder)
+		for (ASTPointer<ASTNode> const& node: source->ast->nodes())
+			if (auto const* contract = dynamic_cast<ContractDefinition const*>(node.get()))
+				contracts.push_back(contract);
+
+	unsigned workers = workerCount(contracts.size(), m_analysisJobs);
+	if (workers <= 1)
+	{
+		bool noErrors = true;
+		TypeChecker typeChecker(m_evmVersion, m_errorReporter);
+		for (auto const* contract: contracts)
+			if (!typeChecker.checkTypeRequirements(*contract))
+				noErrors = false;
+		return noErrors;
+	}
+
+	// Annotations are created on their first access, which must not happen concurrently.
+	struct AnnotationCreator: ASTConstVisitor
+	{
+		bool visitNode(ASTNode const& _node) override { _node.annotation(); return true; }
+	} annotationCreator;
+	for (Source const* source: m_sourceOrder)
+		source->ast->accept(annotationCreator);
+
+	vector<ErrorList> errors(contracts.size());
+	vector<vector<TypeChecker::ContractDependency>> dependencies(contracts.size());
+	vector<char> fatal(contracts.size(), false);
+	parallelFor(contracts.size(), workers, [&](size_t _index, unsigned)
+	{
+		ErrorReporter errorReporter(errors[_index]);
+		TypeChecker typeChecker(m_evmVersion, errorReporter);
+		typeChecker.deferContractDependencies(dependencies[_index]);
+		try
+		{
+			typeChecker.checkTypeRequirements(*contracts[_index]);
+		}
+		catch (FatalError const&)
+		{
+			fatal[_index] = true;
+		}
+	});
+
+	// The contracts are processed in the same order as when checking sequentially,
+	// so that cycles in the contract dependencies are reported at the same place.
+	for (size_t i = 0; i < contracts.size(); ++i)
+	{
+		TypeChecker::addContractDependencies(dependencies[i], errors[i]);
+		m_errorReporter.append(errors[i]);
+		if (fatal[i])
+			BOOST_THROW_EXCEPTION(FatalError());
+	}
+	return !m_errorReporter.hasErrors();
+}
+
 bool CompilerStack::parseAndAnalyze()
 {
 	return parse() && analyze();
@@ -408,14 +575,25 @@ bool CompilerStack::compile()
 
 	// Only compile contracts individually which have been requested.
 	map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
+	// Yul functions of the ABI coder only depend on their name, so they can be shared.
+	auto yulFunctionCache = make_shared<MultiUseYulFunctionCache>();
+	auto inlineAssemblyCache = make_shared<InlineAssemblyCache>();
 	for (Source const* source: m_sourceOrder)
 		for (ASTPointer<ASTNode> const& node: source->ast->nodes())
 			if (auto contract = dynamic_cast<ContractDefinition const*>(node.get()))
 				if (isRequestedContract(*contract))
 				{
-					compileContract(*contract, otherCompilers);
-					if (m_generateIR)
+					if (m_viaIR)
+					{
 						generateIR(*contract);
+						generateEVMFromIR(*contract);
+					}
+					else
+					{
+						compileContract(*contract, otherCompilers, yulFunctionCache, inlineAssemblyCache);
+						if (m_generateIR)
+							generateIR(*contract);
+					}
 				}
 	m_stackState = CompilationSuccessful;
 	this->link();
@@ -461,7 +639,12 @@ eth::AssemblyItems const* CompilerStack::assemblyItems(string const& _contractNa
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Compilation was not successful."));
 
 	Contract const& currentContract = contract(_contractName);
-	return currentContract.compiler ? &contract(_contractName).compiler->assemblyItems() : nullptr;
+	if (currentContract.compiler)
+		return &currentContract.compiler->assemblyItems();
+	else if (currentContract.irAssembly)
+		return &currentContract.irAssembly->items();
+	else
+		return nullptr;
 }
 
 eth::AssemblyItems const* CompilerStack::runtimeAssemblyItems(string const& _contractName) const
@@ -470,7 +653,12 @@ eth::AssemblyItems const* CompilerStack::runtimeAssemblyItems(string const& _con
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Compilation was not successful."));
 
 	Contract const& currentContract = contract(_contractName);
-	return currentContract.compiler ? &contract(_contractName).compiler->runtimeAssemblyItems() : nullptr;
+	if (currentContract.compiler)
+		return &currentContract.compiler->runtimeAssemblyItems();
+	else if (currentContract.irAssembly)
+		return &currentContract.irAssembly->sub(0).items();
+	else
+		return nullptr;
 }
 
 string const* CompilerStack::sourceMapping(string const& _contractName) const
@@ -538,7 +726,7 @@ string const& CompilerStack::yulIROptimized(string const& _contractName) const
 	if (m_stackState != CompilationSuccessful)
 		BOOST_THROW_EXCEPTION(CompilerError() << errinfo_comment("Compilation was not successful."));
 
-	return contract(_contractName).yulIROptimized;
+	return optimizedYulIR(contract(_contractName));
 }
 
 eth::LinkerObject const& CompilerStack::object(string const& _contractName) const
@@ -566,6 +754,8 @@ string CompilerStack::assemblyString(string const& _contractName, StringMap _sou
 	Contract const& currentContract = contract(_contractName);
 	if (currentContract.compiler)
 		return currentContract.compiler->assemblyString(_sourceCodes);
+	else if (currentContract.irAssembly)
+		return currentContract.irAssembly->assemblyString(_sourceCodes);
 	else
 		return string();
 }
@@ -579,6 +769,8 @@ Json::Value CompilerStack::assemblyJSON(string const& _contractName, StringMap c
 	Contract const& currentContract = contract(_contractName);
 	if (currentContract.compiler)
 		return currentContract.compiler->assemblyJSON(_sourceCodes);
+	else if (currentContract.irAssembly)
+		return currentContract.irAssembly->assemblyJSON(_sourceCodes);
 	else
 		return Json::Value();
 }
@@ -750,8 +942,9 @@ tuple<int, int, int, int> CompilerStack::positionFromSourceLocation(SourceLocati
 	int startColumn;
 	int endLine;
 	int endColumn;
-	tie(startLine, startColumn) = scanner(_sourceLocation.source->name()).translatePositionToLineColumn(_sourceLocation.start);
-	tie(endLine, endColumn) = scanner(_sourceLocation.source->name()).translatePositionToLineColumn(_sourceLocation.end);
+	auto lineColumns = _sourceLocation.source->translatePositionsToLineColumns({_sourceLocation.start, _sourceLocation.end});
+	tie(startLine, startColumn) = lineColumns[0];
+	tie(endLine, endColumn) = lineColumns[1];
 
 	return make_tuple(++startLine, ++startColumn, ++endLine, ++endColumn);
 }
@@ -894,7 +1087,9 @@ bool onlySafeExperimentalFeaturesActivated(set<ExperimentalFeature> const& featu
 
 void CompilerStack::compileContract(
 	ContractDefinition const& _contract,
-	map<ContractDefinition const*, shared_ptr<Compiler const>>& _otherCompilers
+	map<ContractDefinition const*, shared_ptr<Compiler const>>& _otherCompilers,
+	shared_ptr<MultiUseYulFunctionCache> const& _yulFunctionCache,
+	shared_ptr<InlineAssemblyCache> const& _inlineAssemblyCache
 )
 {
 	solAssert(m_stackState >= AnalysisSuccessful, "");
@@ -902,11 +1097,16 @@ void CompilerStack::compileContract(
 	if (_otherCompilers.count(&_contract) || !_contract.canBeDeployed())
 		return;
 	for (auto const* dependency: _contract.annotation().contractDependencies)
-		compileContract(*dependency, _otherCompilers);
+		compileContract(*dependency, _otherCompilers, _yulFunctionCache, _inlineAssemblyCache);
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
 
-	shared_ptr<Compiler> compiler = make_shared<Compiler>(m_evmVersion, m_optimiserSettings);
+	shared_ptr<Compiler> compiler = make_shared<Compiler>(
+		m_evmVersion,
+		m_optimiserSettings,
+		_yulFunctionCache,
+		_inlineAssemblyCache
+	);
 	compiledContract.compiler = compiler;
 
 	bytes cborEncodedMetadata = createCBORMetadata(
@@ -962,7 +1162,86 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 		generateIR(*dependency);
 
 	IRGenerator generator(m_evmVersion, m_optimiserSettings);
-	tie(compiledContract.yulIR, compiledContract.yulIROptimized) = generator.run(_contract);
+	compiledContract.yulIR = generator.run(_contract);
+	compiledContract.yulIRStack = generator.takeParsedIR();
+}
+
+string const& CompilerStack::optimizedYulIR(Contract const& _contract) const
+{
+	// caches the result
+	if (!_contract.yulIROptimized)
+	{
+		if (_contract.yulIR.empty())
+			_contract.yulIROptimized.reset(new string());
+		else
+		{
+			if (!_contract.yulIRStack)
+				_contract.yulIRStack = IRGenerator::parse(_contract.yulIR, m_evmVersion, m_optimiserSettings);
+			_contract.yulIROptimized.reset(new string(IRGenerator::optimize(*_contract.yulIRStack)));
+		}
+	}
+	return *_contract.yulIROptimized;
+}
+
+namespace
+{
+
+/// Removes the source locations of the items of @a _assembly and all its sub-assemblies.
+void clearSourceLocations(eth::Assembly& _assembly)
+{
+	for (eth::AssemblyItem& item: _assembly.items())
+		item.setLocation(SourceLocation());
+	for (size_t i = 0; i < _assembly.numSubs(); ++i)
+		clearSourceLocations(_assembly.sub(i));
+}
+
+}
+
+void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
+{
+	solAssert(m_stackState >= AnalysisSuccessful, "");
+
+	if (!_contract.canBeDeployed())
+		return;
+
+	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
+	if (compiledContract.irAssembly)
+		return;
+	solAssert(!compiledContract.yulIR.empty(), "");
+
+	// Shares the parsed and optimized IR with yulIROptimized().
+	optimizedYulIR(compiledContract);
+	shared_ptr<eth::Assembly> assembly = compiledContract.yulIRStack->evmAssembly();
+	// The source locations refer to the generated IR code, which is not a source of the compilation.
+	clearSourceLocations(*assembly);
+	// The runtime object is the only sub-object of the creation object generated by IRGenerator.
+	eth::Assembly& runtimeAssembly = assembly->sub(0);
+	runtimeAssembly.appendAuxiliaryDataToEnd(createCBORMetadata(
+		metadata(compiledContract),
+		!onlySafeExperimentalFeaturesActivated(_contract.sourceUnit().annotation().experimentalFeatures)
+	));
+
+	try
+	{
+		assembly->optimise(CompilerContext::translateOptimiserSettings(m_optimiserSettings, m_evmVersion));
+	}
+	catch(eth::OptimizerException const&)
+	{
+		solAssert(false, "Optimizer exception during compilation");
+	}
+
+	try
+	{
+		// Assemble deployment (incl. runtime) and runtime object.
+		compiledContract.object = assembly->assemble();
+		compiledContract.runtimeObject = runtimeAssembly.assemble();
+	}
+	catch(eth::AssemblyException const&)
+	{
+		solAssert(false, "Assembly exception for bytecode");
+	}
+
+	compiledContract.irAssembly = assembly;
 }
 
 CompilerStack::Contract const& CompilerStack::contract(string const& _contractName) const
@@ -1063,12 +1342,16 @@ string CompilerStack::createMetadata(Contract const& _contract) const
 			details["yulDetails"] = Json::objectValue;
 			details["yulDetails"]["stackAllocation"] = m_optimiserSettings.optimizeStackAllocation;
 		}
+		if (m_optimiserSettings.reuseTemporaryMemory)
+			details["memoryReuse"] = true;
 
 		meta["settings"]["optimizer"]["details"] = std::move(details);
 	}
 
 	meta["settings"]["useLiteralContent"] = m_metadataLiteralSources;
 	meta["settings"]["evmVersion"] = m_evmVersion.name();
+	if (m_viaIR)
+		meta["settings"]["viaIR"] = true;
 	meta["settings"]["compilationTarget"][_contract.contract->sourceUnitName()] =
 		_contract.contract->annotation().canonicalName;
 
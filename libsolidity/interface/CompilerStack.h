@@ -49,6 +49,11 @@ namespace langutil
 class Scanner;
 }
 
+namespace yul
+{
+class AssemblyStack;
+}
+
 namespace dev
 {
 
@@ -71,6 +76,8 @@ class Compiler;
 class GlobalContext;
 class Natspec;
 class DeclarationContainer;
+class MultiUseYulFunctionCache;
+class InlineAssemblyCache;
 
 /**
  * Easy to use and self-contained Solidity compiler with as few header dependencies as possible.
@@ -145,6 +152,10 @@ public:
 	/// Enable experimental generation of Yul IR code.
 	void enableIRGeneration(bool _enable = true) { m_generateIR = _enable; }
 
+	/// Enable experimental generation of the bytecode from the optimised Yul IR code
+	/// instead of using the legacy code generator. Implies generation of Yul IR code.
+	void enableCodeGenerationViaIR(bool _enable = true) { m_viaIR = _enable; }
+
 	/// @arg _metadataLiteralSources When true, store sources as literals in the contract metadata.
 	/// Must be set before parsing.
 	void useMetadataLiteralSources(bool _metadataLiteralSources);
@@ -152,6 +163,17 @@ public:
 	/// Sets the sources. Must be set before parsing.
 	void setSources(StringMap _sources);
 
+	/// Sets the maximum number of threads the SMTChecker uses to verify functions.
+	/// Zero selects the number of hardware threads.
+	/// Must be set before parsing.
+	void setSMTCheckerJobs(unsigned _jobs = 1);
+
+	/// Sets the maximum number of threads used to run the source-local analysis passes
+	/// and the type checker.
+	/// Zero selects the number of hardware threads. Diagnostics do not depend on this setting.
+	/// Must be set before parsing.
+	void setAnalysisJobs(unsigned _jobs = 1);
+
 	/// Adds a response to an SMTLib2 query (identified by the hash of the query input).
 	/// Must be set before parsing.
 	void addSMTLib2Response(h256 const& _hash, std::string const& _response);
@@ -208,6 +230,7 @@ public:
 	std::string const& yulIR(std::string const& _contractName) const;
 
 	/// @returns the optimized IR representation of a contract.
+	/// The IR is only parsed and optimized on the first request.
 	std::string const& yulIROptimized(std::string const& _contractName) const;
 
 	/// @returns the assembled object for a contract.
@@ -282,7 +305,11 @@ private:
 		eth::LinkerObject object; ///< Deployment object (includes the runtime sub-object).
 		eth::LinkerObject runtimeObject; ///< Runtime object.
 		std::string yulIR; ///< Experimental Yul IR code.
-		std::string yulIROptimized; ///< Optimized experimental Yul IR code.
+		mutable std::unique_ptr<std::string const> yulIROptimized; ///< Optimized experimental Yul IR code.
+		/// Parsed experimental Yul IR code, which is optimized in place together with setting yulIROptimized.
+		mutable std::shared_ptr<yul::AssemblyStack> yulIRStack;
+		/// Assembly compiled from the optimized Yul IR code, if the code is generated via the IR.
+		std::shared_ptr<eth::Assembly const> irAssembly;
 		mutable std::unique_ptr<std::string const> metadata; ///< The metadata json that will be hashed into the chain.
 		mutable std::unique_ptr<Json::Value const> abi;
 		mutable std::unique_ptr<Json::Value const> userDocumentation;
@@ -298,21 +325,51 @@ private:
 	std::string applyRemapping(std::string const& _path, std::string const& _context);
 	void resolveImports();
 
+	/// Runs @a _analysis on the AST of every source, concurrently if more than one analysis job
+	/// is configured. Each run gets its own error reporter and the errors are merged in source order.
+	/// A FatalError is re-thrown after merging the errors of the first source that raised one.
+	/// @returns false if @a _analysis returned false for any source.
+	bool analyzeSources(std::function<bool(SourceUnit const&, langutil::ErrorReporter&)> const& _analysis);
+
+	/// Runs the analyses that require a successful type check (post type checking, control flow
+	/// analysis, static analysis and state mutability checking) in a single traversal of each source,
+	/// concurrently if more than one analysis job is configured. Errors are reported as if the
+	/// analyses ran one after the other and each only if all previous ones succeeded.
+	/// @returns false if there are any errors.
+	bool runPostTypeCheckingAnalyses();
+
+	/// Runs the type checker on all contracts, concurrently if more than one analysis job
+	/// is configured. Errors are reported in the same order as when checking sequentially.
+	/// @returns false if there are any errors.
+	bool typeCheckContracts();
+
 	/// @returns true if the contract is requested to be compiled.
 	bool isRequestedContract(ContractDefinition const& _contract) const;
 
 	/// Compile a single contract.
 	/// @param _otherCompilers provides access to compilers of other contracts, to get
 	///                        their bytecode if needed. Only filled after they have been compiled.
+	/// @param _yulFunctionCache cache of generated Yul functions shared by all contracts.
+	/// @param _inlineAssemblyCache cache of parsed inline assembly shared by all contracts.
 	void compileContract(
 		ContractDefinition const& _contract,
-		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>>& _otherCompilers
+		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>>& _otherCompilers,
+		std::shared_ptr<MultiUseYulFunctionCache> const& _yulFunctionCache,
+		std::shared_ptr<InlineAssemblyCache> const& _inlineAssemblyCache
 	);
 
 	/// Generate Yul IR for a single contract.
 	/// The IR is stored but otherwise unused.
 	void generateIR(ContractDefinition const& _contract);
 
+	/// @returns the optimized Yul IR of @a _contract, which is only parsed (unless already
+	/// done by generateIR) and optimized on the first call.
+	std::string const& optimizedYulIR(Contract const& _contract) const;
+
+	/// Compile the optimized Yul IR of a single contract (generated by generateIR)
+	/// into its deployment and runtime objects.
+	void generateEVMFromIR(ContractDefinition const& _contract);
+
 	/// Links all the known library addresses in the available objects. Any unknown
 	/// library will still be kept as an unlinked placeholder in the objects.
 	void link();
@@ -366,6 +423,7 @@ private:
 	langutil::EVMVersion m_evmVersion;
 	std::set<std::string> m_requestedContractNames;
 	bool m_generateIR;
+	bool m_viaIR = false;
 	std::map<std::string, h160> m_libraries;
 	/// list of path prefix remappings, e.g. mylibrary: github.com/ethereum = /usr/local/ethereum
 	/// "context:prefix=target"
@@ -373,6 +431,8 @@ private:
 	std::map<std::string const, Source> m_sources;
 	std::vector<std::string> m_unhandledSMTLib2Queries;
 	std::map<h256, std::string> m_smtlib2Responses;
+	unsigned m_smtCheckerJobs = 1;
+	unsigned m_analysisJobs = 1;
 	std::shared_ptr<GlobalContext> m_globalContext;
 	std::vector<Source const*> m_sourceOrder;
 	/// This is updated during compilation.
@@ -22,6 +22,7 @@
 
 #include <libsolidity/interface/StandardCompiler.h>
 
+#include <libsolidity/ast/ASTBinaryConverter.h>
 #include <libsolidity/ast/ASTJsonConverter.h>
 #include <libyul/AssemblyStack.h>
 #include <liblangutil/SourceReferenceFormatter.h>
@@ -137,6 +138,9 @@ bool isArtifactRequested(Json::Value const& _outputSelection, string const& _art
 			return true;
 		else if (artifact == "*")
 		{
+			// "astBinary" duplicates "ast" and is never matched by "*".
+			if (_artifact == "astBinary")
+				continue;
 			// "ir" and "irOptimized" can only be matched by "*" if activated.
 			if ((_artifact != "ir" && _artifact != "irOptimized") || _wildcardMatchesIR)
 				return true;
@@ -301,7 +305,7 @@ boost::optional<Json::Value> checkAuxiliaryInputKeys(Json::Value const& _input)
 
 boost::optional<Json::Value> checkSettingsKeys(Json::Value const& _input)
 {
-	static set<string> keys{"evmVersion", "libraries", "metadata", "optimizer", "outputSelection", "remappings"};
+	static set<string> keys{"evmVersion", "libraries", "metadata", "optimizer", "outputSelection", "remappings", "viaIR"};
 	return checkKeys(_input, keys, "settings");
 }
 
@@ -313,7 +317,7 @@ boost::optional<Json::Value> checkOptimizerKeys(Json::Value const& _input)
 
 boost::optional<Json::Value> checkOptimizerDetailsKeys(Json::Value const& _input)
 {
-	static set<string> keys{"peephole", "jumpdestRemover", "orderLiterals", "deduplicate", "cse", "constantOptimizer", "yul", "yulDetails"};
+	static set<string> keys{"peephole", "jumpdestRemover", "orderLiterals", "deduplicate", "cse", "constantOptimizer", "yul", "yulDetails", "memoryReuse"};
 	return checkKeys(_input, keys, "settings.optimizer.details");
 }
 
@@ -424,6 +428,8 @@ boost::variant<OptimiserSettings, Json::Value> parseOptimizerSettings(Json::Valu
 			return *error;
 		if (auto error = checkOptimizerDetail(details, "yul", settings.runYulOptimiser))
 			return *error;
+		if (auto error = checkOptimizerDetail(details, "memoryReuse", settings.reuseTemporaryMemory))
+			return *error;
 		if (settings.runYulOptimiser)
 			settings.optimizeStackAllocation = true;
 		if (details.isMember("yulDetails"))
@@ -586,6 +592,13 @@ boost::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompile
 		ret.evmVersion = *version;
 	}
 
+	if (settings.isMember("viaIR"))
+	{
+		if (!settings["viaIR"].isBool())
+			return formatFatalError("JSONError", "\"settings.viaIR\" must be a Boolean.");
+		ret.viaIR = settings["viaIR"].asBool();
+	}
+
 	if (settings.isMember("remappings") && !settings["remappings"].isArray())
 		return formatFatalError("JSONError", "\"settings.remappings\" must be an array of strings.");
 
@@ -684,6 +697,7 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 	bool const irRequested = isIRRequested(_inputsAndSettings.outputSelection);
 
 	compilerStack.enableIRGeneration(irRequested);
+	compilerStack.enableCodeGenerationViaIR(_inputsAndSettings.viaIR);
 
 	Json::Value errors = std::move(_inputsAndSettings.errors);
 
@@ -807,6 +821,8 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 			sourceResult["ast"] = ASTJsonConverter(false, compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName));
 		if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, "", "legacyAST", wildcardMatchesIR))
 			sourceResult["legacyAST"] = ASTJsonConverter(true, compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName));
+		if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, "", "astBinary", wildcardMatchesIR))
+			sourceResult["astBinary"] = toHex(ASTBinaryConverter(compilerStack.sourceIndices()).toBinary(compilerStack.ast(sourceName)));
 		output["sources"][sourceName] = sourceResult;
 	}
 
@@ -897,6 +913,8 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 		return formatFatalError("JSONError", "Field \"settings.remappings\" cannot be used for Yul.");
 	if (!_inputsAndSettings.libraries.empty())
 		return formatFatalError("JSONError", "Field \"settings.libraries\" cannot be used for Yul.");
+	if (_inputsAndSettings.viaIR)
+		return formatFatalError("JSONError", "Field \"settings.viaIR\" cannot be used for Yul.");
 
 	Json::Value output = Json::objectValue;
 
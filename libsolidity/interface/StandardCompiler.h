@@ -67,6 +67,7 @@ private:
 		OptimiserSettings optimiserSettings = OptimiserSettings::minimal();
 		std::map<std::string, h160> libraries;
 		bool metadataLiteralSources = false;
+		bool viaIR = false;
 		Json::Value outputSelection;
 	};
 
@@ -45,7 +45,7 @@ using namespace yul;
 
 namespace
 {
-shared_ptr<Dialect> languageToDialect(AssemblyStack::Language _language, EVMVersion _version)
+shared_ptr<Dialect const> languageToDialect(AssemblyStack::Language _language, EVMVersion _version)
 {
 	switch (_language)
 	{
@@ -118,9 +118,22 @@ bool AssemblyStack::analyzeParsed(Object& _object)
 	return success;
 }
 
+shared_ptr<dev::eth::Assembly> AssemblyStack::evmAssembly() const
+{
+	solAssert(m_analysisSuccessful, "");
+	solAssert(m_parserResult, "");
+	solAssert(m_parserResult->code, "");
+	solAssert(m_parserResult->analysisInfo, "");
+
+	auto assembly = make_shared<dev::eth::Assembly>();
+	EthAssemblyAdapter adapter(*assembly);
+	compileEVM(adapter, false, m_optimiserSettings.optimizeStackAllocation);
+	return assembly;
+}
+
 void AssemblyStack::compileEVM(AbstractAssembly& _assembly, bool _evm15, bool _optimize) const
 {
-	shared_ptr<EVMDialect> dialect;
+	shared_ptr<EVMDialect const> dialect;
 
 	if (m_language == Language::Assembly)
 		dialect = EVMDialect::looseAssemblyForEVM(m_evmVersion);
@@ -161,11 +174,9 @@ MachineAssemblyObject AssemblyStack::assemble(Machine _machine) const
 	case Machine::EVM:
 	{
 		MachineAssemblyObject object;
-		dev::eth::Assembly assembly;
-		EthAssemblyAdapter adapter(assembly);
-		compileEVM(adapter, false, m_optimiserSettings.optimizeStackAllocation);
-		object.bytecode = make_shared<dev::eth::LinkerObject>(assembly.assemble());
-		object.assembly = assembly.assemblyString();
+		shared_ptr<dev::eth::Assembly> assembly = evmAssembly();
+		object.bytecode = make_shared<dev::eth::LinkerObject>(assembly->assemble());
+		object.assembly = assembly->assemblyString();
 		return object;
 	}
 	case Machine::EVM15:
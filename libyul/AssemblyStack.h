@@ -39,6 +39,14 @@ namespace langutil
 class Scanner;
 }
 
+namespace dev
+{
+namespace eth
+{
+class Assembly;
+}
+}
+
 namespace yul
 {
 class AbstractAssembly;
@@ -84,6 +92,11 @@ public:
 	/// Run the assembly step (should only be called after parseAndAnalyze).
 	MachineAssemblyObject assemble(Machine _machine) const;
 
+	/// Run the code generation step for the EVM (should only be called after parseAndAnalyze).
+	/// @returns the assembly before it is assembled, such that it can still be optimised
+	/// or extended.
+	std::shared_ptr<dev::eth::Assembly> evmAssembly() const;
+
 	/// @returns the errors generated during parsing, analysis (and potentially assembly).
 	langutil::ErrorList const& errors() const { return m_errors; }
 
@@ -28,12 +28,35 @@
 
 #include <liblangutil/EVMVersion.h>
 
+#include <mutex>
+#include <tuple>
+
 using namespace std;
 using namespace yul;
 using namespace dev;
 
+namespace
+{
+
+/// @returns the code-less copy of @a _dialect, which is created on the first request
+/// and shared by all later requests for a dialect with the same properties.
+shared_ptr<NoOutputEVMDialect const> sharedNoOutputDialect(EVMDialect const& _dialect)
+{
+	static mutex dialectsMutex;
+	static map<tuple<AsmFlavour, bool, langutil::EVMVersion>, shared_ptr<NoOutputEVMDialect const>> dialects;
+
+	lock_guard<mutex> lock(dialectsMutex);
+	shared_ptr<NoOutputEVMDialect const>& dialect =
+		dialects[make_tuple(_dialect.flavour, _dialect.providesObjectAccess(), _dialect.evmVersion())];
+	if (!dialect)
+		dialect = make_shared<NoOutputEVMDialect>(_dialect);
+	return dialect;
+}
+
+}
+
 map<YulString, int> CompilabilityChecker::run(
-	shared_ptr<Dialect> _dialect,
+	shared_ptr<Dialect const> _dialect,
 	Block const& _ast,
 	bool _optimizeStackAllocation
 )
@@ -44,13 +67,14 @@ map<YulString, int> CompilabilityChecker::run(
 	solAssert(_dialect->flavour == AsmFlavour::Strict, "");
 
 	solAssert(dynamic_cast<EVMDialect const*>(_dialect.get()), "");
-	shared_ptr<NoOutputEVMDialect> noOutputDialect = make_shared<NoOutputEVMDialect>(dynamic_pointer_cast<EVMDialect>(_dialect));
+	shared_ptr<NoOutputEVMDialect const> noOutputDialect = sharedNoOutputDialect(dynamic_cast<EVMDialect const&>(*_dialect));
 
 	yul::AsmAnalysisInfo analysisInfo =
 		yul::AsmAnalyzer::analyzeStrictAssertCorrect(noOutputDialect, _ast);
 
 	NoOutputAssembly assembly;
-	CodeTransform transform(assembly, analysisInfo, _ast, *noOutputDialect, _optimizeStackAllocation);
+	BuiltinContext builtinContext;
+	CodeTransform transform(assembly, analysisInfo, _ast, *noOutputDialect, builtinContext, _optimizeStackAllocation);
 	try
 	{
 		transform(_ast);
@@ -40,7 +40,7 @@ class CompilabilityChecker
 {
 public:
 	static std::map<YulString, int> run(
-		std::shared_ptr<Dialect> _dialect,
+		std::shared_ptr<Dialect const> _dialect,
 		Block const& _ast,
 		bool _optimizeStackAllocation
 	);
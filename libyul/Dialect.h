@@ -24,6 +24,7 @@
 
 #include <boost/noncopyable.hpp>
 
+#include <memory>
 #include <vector>
 
 namespace yul
@@ -62,10 +63,12 @@ struct Dialect: boost::noncopyable
 	Dialect(AsmFlavour _flavour): flavour(_flavour) {}
 	virtual ~Dialect() = default;
 
-	static std::shared_ptr<Dialect> yul()
+	/// @returns the shared instance of the Yul dialect.
+	static std::shared_ptr<Dialect const> yul()
 	{
 		// Will have to add builtins later.
-		return std::make_shared<Dialect>(AsmFlavour::Yul);
+		static std::shared_ptr<Dialect const> const dialect = std::make_shared<Dialect>(AsmFlavour::Yul);
+		return dialect;
 	}
 };
 
@@ -24,6 +24,7 @@
 
 #include <unordered_map>
 #include <memory>
+#include <mutex>
 #include <vector>
 #include <string>
 
@@ -34,6 +35,7 @@ namespace yul
 /// Owns the string data for all YulStrings, which can be referenced by a Handle.
 /// A Handle consists of an ID (that depends on the insertion order of YulStrings and is potentially
 /// non-deterministic) and a deterministic string hash.
+/// The repository can be used from multiple threads.
 class YulStringRepository: boost::noncopyable
 {
 public:
@@ -55,6 +57,7 @@ public:
 		if (_string.empty())
 			return { 0, emptyHash() };
 		std::uint64_t h = hash(_string);
+		std::lock_guard<std::mutex> lock(m_mutex);
 		auto range = m_hashToID.equal_range(h);
 		for (auto it = range.first; it != range.second; ++it)
 			if (*m_strings[it->second] == _string)
@@ -64,7 +67,12 @@ public:
 		m_hashToID.emplace_hint(range.second, std::make_pair(h, id));
 		return Handle{id, h};
 	}
-	std::string const& idToString(size_t _id) const	{ return *m_strings.at(_id); }
+	std::string const& idToString(size_t _id) const
+	{
+		// The strings themselves are never moved, only the vector of pointers to them.
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return *m_strings.at(_id);
+	}
 
 	static std::uint64_t hash(std::string const& v)
 	{
@@ -81,6 +89,7 @@ public:
 	static constexpr std::uint64_t emptyHash() { return 14695981039346656037u; }
 
 private:
+	mutable std::mutex m_mutex;
 	std::vector<std::shared_ptr<std::string>> m_strings = {std::make_shared<std::string>()};
 	std::unordered_multimap<std::uint64_t, size_t> m_hashToID = {{emptyHash(), 0}};
 };
@@ -117,6 +126,9 @@ public:
 	bool operator!=(YulString const& _other) const { return m_handle.id != _other.m_handle.id; }
 
 	bool empty() const { return m_handle.id == 0; }
+	/// @returns the ID of the string in the repository. It is small and dense, but can differ
+	/// between runs, so it must not influence the output.
+	size_t id() const { return m_handle.id; }
 	std::string const& str() const
 	{
 		return YulStringRepository::instance().idToString(m_handle.id);
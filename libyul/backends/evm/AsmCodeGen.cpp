@@ -184,12 +184,13 @@ void CodeGenerator::assemble(
 )
 {
 	EthAssemblyAdapter assemblyAdapter(_assembly);
-	shared_ptr<EVMDialect> dialect = EVMDialect::strictAssemblyForEVM(_evmVersion);
+	BuiltinContext builtinContext;
 	CodeTransform transform(
 		assemblyAdapter,
 		_analysisInfo,
 		_parsedData,
-		*dialect,
+		*EVMDialect::strictAssemblyForEVM(_evmVersion),
+		builtinContext,
 		_optimizeStackAllocation,
 		false,
 		_identifierAccess,
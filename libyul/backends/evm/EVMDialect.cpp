@@ -31,6 +31,9 @@
 
 #include <boost/range/adaptor/reversed.hpp>
 
+#include <mutex>
+#include <tuple>
+
 using namespace std;
 using namespace dev;
 using namespace yul;
@@ -42,43 +45,46 @@ EVMDialect::EVMDialect(AsmFlavour _flavour, bool _objectAccess, langutil::EVMVer
 	if (!m_objectAccess)
 		return;
 
-	addFunction("datasize", 1, 1, true, true, [this](
+	addFunction("datasize", 1, 1, true, true, [](
 		FunctionCall const& _call,
 		AbstractAssembly& _assembly,
+		BuiltinContext& _context,
 		std::function<void()>
 	) {
-		yulAssert(m_currentObject, "No object available.");
+		yulAssert(_context.currentObject, "No object available.");
 		yulAssert(_call.arguments.size() == 1, "");
 		Expression const& arg = _call.arguments.front();
 		YulString dataName = boost::get<Literal>(arg).value;
-		if (m_currentObject->name == dataName)
+		if (_context.currentObject->name == dataName)
 			_assembly.appendAssemblySize();
 		else
 		{
-			yulAssert(m_subIDs.count(dataName) != 0, "Could not find assembly object <" + dataName.str() + ">.");
-			_assembly.appendDataSize(m_subIDs.at(dataName));
+			yulAssert(_context.subIDs.count(dataName) != 0, "Could not find assembly object <" + dataName.str() + ">.");
+			_assembly.appendDataSize(_context.subIDs.at(dataName));
 		}
 	});
-	addFunction("dataoffset", 1, 1, true, true, [this](
+	addFunction("dataoffset", 1, 1, true, true, [](
 		FunctionCall const& _call,
 		AbstractAssembly& _assembly,
+		BuiltinContext& _context,
 		std::function<void()>
 	) {
-		yulAssert(m_currentObject, "No object available.");
+		yulAssert(_context.currentObject, "No object available.");
 		yulAssert(_call.arguments.size() == 1, "");
 		Expression const& arg = _call.arguments.front();
 		YulString dataName = boost::get<Literal>(arg).value;
-		if (m_currentObject->name == dataName)
+		if (_context.currentObject->name == dataName)
 			_assembly.appendConstant(0);
 		else
 		{
-			yulAssert(m_subIDs.count(dataName) != 0, "Could not find assembly object <" + dataName.str() + ">.");
-			_assembly.appendDataOffset(m_subIDs.at(dataName));
+			yulAssert(_context.subIDs.count(dataName) != 0, "Could not find assembly object <" + dataName.str() + ">.");
+			_assembly.appendDataOffset(_context.subIDs.at(dataName));
 		}
 	});
 	addFunction("datacopy", 3, 0, false, false, [](
 		FunctionCall const&,
 		AbstractAssembly& _assembly,
+		BuiltinContext&,
 		std::function<void()> _visitArguments
 	) {
 		_visitArguments();
@@ -88,43 +94,49 @@ EVMDialect::EVMDialect(AsmFlavour _flavour, bool _objectAccess, langutil::EVMVer
 
 BuiltinFunctionForEVM const* EVMDialect::builtin(YulString _name) const
 {
-	auto it = m_functions.find(_name);
-	if (it != m_functions.end())
-		return &it->second;
+	if (_name.id() < m_builtinsByID.size())
+		return m_builtinsByID[_name.id()];
 	else
 		return nullptr;
 }
 
-shared_ptr<EVMDialect> EVMDialect::looseAssemblyForEVM(langutil::EVMVersion _version)
+namespace
 {
-	return make_shared<EVMDialect>(AsmFlavour::Loose, false, _version);
-}
 
-shared_ptr<EVMDialect> EVMDialect::strictAssemblyForEVM(langutil::EVMVersion _version)
+/// @returns the dialect with the given properties, which is created on the first request
+/// and shared by all later requests.
+shared_ptr<EVMDialect const> sharedDialect(AsmFlavour _flavour, bool _objectAccess, langutil::EVMVersion _version)
 {
-	return make_shared<EVMDialect>(AsmFlavour::Strict, false, _version);
+	static mutex dialectsMutex;
+	static map<tuple<AsmFlavour, bool, langutil::EVMVersion>, shared_ptr<EVMDialect const>> dialects;
+
+	lock_guard<mutex> lock(dialectsMutex);
+	shared_ptr<EVMDialect const>& dialect = dialects[make_tuple(_flavour, _objectAccess, _version)];
+	if (!dialect)
+		dialect = make_shared<EVMDialect>(_flavour, _objectAccess, _version);
+	return dialect;
 }
 
-shared_ptr<EVMDialect> EVMDialect::strictAssemblyForEVMObjects(langutil::EVMVersion _version)
+}
+
+shared_ptr<EVMDialect const> EVMDialect::looseAssemblyForEVM(langutil::EVMVersion _version)
 {
-	return make_shared<EVMDialect>(AsmFlavour::Strict, true, _version);
+	return sharedDialect(AsmFlavour::Loose, false, _version);
 }
 
-shared_ptr<yul::EVMDialect> EVMDialect::yulForEVM(langutil::EVMVersion _version)
+shared_ptr<EVMDialect const> EVMDialect::strictAssemblyForEVM(langutil::EVMVersion _version)
 {
-	return make_shared<EVMDialect>(AsmFlavour::Yul, false, _version);
+	return sharedDialect(AsmFlavour::Strict, false, _version);
 }
 
-void EVMDialect::setSubIDs(map<YulString, AbstractAssembly::SubID> _subIDs)
+shared_ptr<EVMDialect const> EVMDialect::strictAssemblyForEVMObjects(langutil::EVMVersion _version)
 {
-	yulAssert(m_objectAccess, "Sub IDs set with dialect that does not support object access.");
-	m_subIDs = std::move(_subIDs);
+	return sharedDialect(AsmFlavour::Strict, true, _version);
 }
 
-void EVMDialect::setCurrentObject(Object const* _object)
+shared_ptr<EVMDialect const> EVMDialect::yulForEVM(langutil::EVMVersion _version)
 {
-	yulAssert(m_objectAccess, "Current object set with dialect that does not support object access.");
-	m_currentObject = _object;
+	return sharedDialect(AsmFlavour::Yul, false, _version);
 }
 
 void EVMDialect::addFunction(
@@ -133,7 +145,7 @@ void EVMDialect::addFunction(
 	size_t _returns,
 	bool _movable,
 	bool _literalArguments,
-	std::function<void(FunctionCall const&, AbstractAssembly&, std::function<void()>)> _generateCode
+	std::function<void(FunctionCall const&, AbstractAssembly&, BuiltinContext&, std::function<void()>)> _generateCode
 )
 {
 	YulString name{std::move(_name)};
@@ -144,4 +156,8 @@ void EVMDialect::addFunction(
 	f.movable = _movable;
 	f.literalArguments = _literalArguments;
 	f.generateCode = std::move(_generateCode);
+
+	if (m_builtinsByID.size() <= name.id())
+		m_builtinsByID.resize(name.id() + 1, nullptr);
+	m_builtinsByID[name.id()] = &f;
 }
@@ -26,6 +26,7 @@
 #include <liblangutil/EVMVersion.h>
 
 #include <map>
+#include <vector>
 
 namespace yul
 {
@@ -35,18 +36,30 @@ using Type = YulString;
 struct FunctionCall;
 struct Object;
 
+/**
+ * Context of the code generation for an object, used by the builtin functions.
+ */
+struct BuiltinContext
+{
+	Object const* currentObject = nullptr;
+	/// Mapping from named objects to abstract assembly sub IDs.
+	std::map<YulString, AbstractAssembly::SubID> subIDs;
+};
+
 struct BuiltinFunctionForEVM: BuiltinFunction
 {
 	/// Function to generate code for the given function call and append it to the abstract
-	/// assembly. The third parameter is called to visit (and generate code for) the arguments
+	/// assembly. The fourth parameter is called to visit (and generate code for) the arguments
 	/// from right to left.
-	std::function<void(FunctionCall const&, AbstractAssembly&, std::function<void()>)> generateCode;
+	std::function<void(FunctionCall const&, AbstractAssembly&, BuiltinContext&, std::function<void()>)> generateCode;
 };
 
 /**
  * Yul dialect for EVM as a backend.
  * The main difference is that the builtin functions take an AbstractAssembly for the
  * code generation.
+ * Dialects are immutable, the state of the code generation is kept in a BuiltinContext,
+ * such that the instances returned by the static functions can be shared.
  */
 struct EVMDialect: public Dialect
 {
@@ -55,20 +68,16 @@ struct EVMDialect: public Dialect
 	/// @returns the builtin function of the given name or a nullptr if it is not a builtin function.
 	BuiltinFunctionForEVM const* builtin(YulString _name) const override;
 
-	static std::shared_ptr<EVMDialect> looseAssemblyForEVM(langutil::EVMVersion _version);
-	static std::shared_ptr<EVMDialect> strictAssemblyForEVM(langutil::EVMVersion _version);
-	static std::shared_ptr<EVMDialect> strictAssemblyForEVMObjects(langutil::EVMVersion _version);
-	static std::shared_ptr<EVMDialect> yulForEVM(langutil::EVMVersion _version);
+	/// The functions below return one instance per EVM version, created on first use.
+	static std::shared_ptr<EVMDialect const> looseAssemblyForEVM(langutil::EVMVersion _version);
+	static std::shared_ptr<EVMDialect const> strictAssemblyForEVM(langutil::EVMVersion _version);
+	static std::shared_ptr<EVMDialect const> strictAssemblyForEVMObjects(langutil::EVMVersion _version);
+	static std::shared_ptr<EVMDialect const> yulForEVM(langutil::EVMVersion _version);
 
 	langutil::EVMVersion evmVersion() const { return m_evmVersion; }
 
 	bool providesObjectAccess() const { return m_objectAccess; }
 
-	/// Sets the mapping of current sub assembly IDs. Used during code generation.
-	void setSubIDs(std::map<YulString, AbstractAssembly::SubID> _subIDs);
-	/// Sets the current object. Used during code generation.
-	void setCurrentObject(Object const* _object);
-
 protected:
 	void addFunction(
 		std::string _name,
@@ -76,15 +85,14 @@ protected:
 		size_t _returns,
 		bool _movable,
 		bool _literalArguments,
-		std::function<void(FunctionCall const&, AbstractAssembly&, std::function<void()>)> _generateCode
+		std::function<void(FunctionCall const&, AbstractAssembly&, BuiltinContext&, std::function<void()>)> _generateCode
 	);
 
 	bool m_objectAccess;
 	langutil::EVMVersion m_evmVersion;
-	Object const* m_currentObject = nullptr;
-	/// Mapping from named objects to abstract assembly sub IDs.
-	std::map<YulString, AbstractAssembly::SubID> m_subIDs;
 	std::map<YulString, BuiltinFunctionForEVM> m_functions;
+	/// Pointers into m_functions, indexed by the ID of the name of the function.
+	std::vector<BuiltinFunctionForEVM const*> m_builtinsByID;
 };
 
 }
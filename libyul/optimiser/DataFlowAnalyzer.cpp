@@ -26,6 +26,7 @@
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/Exceptions.h>
 #include <libyul/AsmData.h>
+#include <libyul/Utilities.h>
 
 #include <libdevcore/CommonData.h>
 
@@ -35,12 +36,45 @@ using namespace std;
 using namespace dev;
 using namespace yul;
 
+void DataFlowAnalyzer::operator()(ExpressionStatement& _statement)
+{
+	if (auto vars = isSimpleStore(dev::eth::Instruction::SSTORE, _statement))
+	{
+		ASTModifier::operator()(_statement);
+		// Other slots keep their value if they are different or already hold the stored value.
+		set<YulString> keysToErase;
+		for (auto const& item: m_storage)
+			if (!knownToBeDifferent(vars->first, item.first) && !knownToBeEqual(vars->second, item.second))
+				keysToErase.insert(item.first);
+		for (YulString const& key: keysToErase)
+			m_storage.erase(key);
+		m_storage[vars->first] = vars->second;
+	}
+	else if (auto vars = isSimpleStore(dev::eth::Instruction::MSTORE, _statement))
+	{
+		ASTModifier::operator()(_statement);
+		set<YulString> keysToErase;
+		for (auto const& item: m_memory)
+			if (!knownToBeDifferentByAtLeast32(vars->first, item.first))
+				keysToErase.insert(item.first);
+		for (YulString const& key: keysToErase)
+			m_memory.erase(key);
+		m_memory[vars->first] = vars->second;
+	}
+	else
+	{
+		clearKnowledgeIfInvalidated(_statement.expression);
+		ASTModifier::operator()(_statement);
+	}
+}
+
 void DataFlowAnalyzer::operator()(Assignment& _assignment)
 {
 	set<YulString> names;
 	for (auto const& var: _assignment.variableNames)
 		names.emplace(var.name);
 	assertThrow(_assignment.value, OptimizerException, "");
+	clearKnowledgeIfInvalidated(*_assignment.value);
 	visit(*_assignment.value);
 	handleAssignment(names, _assignment.value.get());
 }
@@ -53,15 +87,24 @@ void DataFlowAnalyzer::operator()(VariableDeclaration& _varDecl)
 	m_variableScopes.back().variables += names;
 
 	if (_varDecl.value)
+	{
+		clearKnowledgeIfInvalidated(*_varDecl.value);
 		visit(*_varDecl.value);
+	}
 
 	handleAssignment(names, _varDecl.value.get());
 }
 
 void DataFlowAnalyzer::operator()(If& _if)
 {
+	clearKnowledgeIfInvalidated(*_if.condition);
+	map<YulString, YulString> storage = m_storage;
+	map<YulString, YulString> memory = m_memory;
+
 	ASTModifier::operator()(_if);
 
+	joinKnowledge(storage, memory);
+
 	Assignments assignments;
 	assignments(_if.body);
 	clearValues(assignments.names());
@@ -69,11 +112,16 @@ void DataFlowAnalyzer::operator()(If& _if)
 
 void DataFlowAnalyzer::operator()(Switch& _switch)
 {
+	clearKnowledgeIfInvalidated(*_switch.expression);
 	visit(*_switch.expression);
 	set<YulString> assignedVariables;
 	for (auto& _case: _switch.cases)
 	{
+		map<YulString, YulString> storage = m_storage;
+		map<YulString, YulString> memory = m_memory;
 		(*this)(_case.body);
+		joinKnowledge(storage, memory);
+
 		Assignments assignments;
 		assignments(_case.body);
 		assignedVariables += assignments.names();
@@ -90,9 +138,13 @@ void DataFlowAnalyzer::operator()(FunctionDefinition& _fun)
 	map<YulString, Expression const*> value;
 	map<YulString, set<YulString>> references;
 	map<YulString, set<YulString>> referencedBy;
+	map<YulString, YulString> storage;
+	map<YulString, YulString> memory;
 	m_value.swap(value);
 	m_references.swap(references);
 	m_referencedBy.swap(referencedBy);
+	m_storage.swap(storage);
+	m_memory.swap(memory);
 	pushScope(true);
 
 	for (auto const& parameter: _fun.parameters)
@@ -108,6 +160,8 @@ void DataFlowAnalyzer::operator()(FunctionDefinition& _fun)
 	m_value.swap(value);
 	m_references.swap(references);
 	m_referencedBy.swap(referencedBy);
+	m_storage.swap(storage);
+	m_memory.swap(memory);
 }
 
 void DataFlowAnalyzer::operator()(ForLoop& _for)
@@ -123,12 +177,21 @@ void DataFlowAnalyzer::operator()(ForLoop& _for)
 	assignments(_for.body);
 	assignments(_for.post);
 	clearValues(assignments.names());
+	// The loop might be entered again or left from within the body, so knowledge about
+	// storage and memory is cleared if any of its parts modifies them.
+	clearKnowledgeIfInvalidated(*_for.condition);
+	clearKnowledgeIfInvalidated(_for.body);
+	clearKnowledgeIfInvalidated(_for.post);
 
 	visit(*_for.condition);
 	(*this)(_for.body);
 	clearValues(assignmentsSinceCont.names());
+	clearKnowledgeIfInvalidated(_for.body);
 	(*this)(_for.post);
 	clearValues(assignments.names());
+	clearKnowledgeIfInvalidated(*_for.condition);
+	clearKnowledgeIfInvalidated(_for.body);
+	clearKnowledgeIfInvalidated(_for.post);
 }
 
 void DataFlowAnalyzer::operator()(Block& _block)
@@ -168,6 +231,21 @@ void DataFlowAnalyzer::handleAssignment(set<YulString> const& _variables, Expres
 		for (auto const& ref: referencedVariables)
 			m_referencedBy[ref].emplace(name);
 	}
+
+	// A variable that is assigned a load holds the loaded value until storage
+	// or memory is modified.
+	if (_value && _variables.size() == 1)
+	{
+		YulString name = *_variables.begin();
+		if (auto key = isSimpleLoad(dev::eth::Instruction::SLOAD, *_value))
+		{
+			if (*key != name)
+				m_storage[*key] = name;
+		}
+		else if (auto key = isSimpleLoad(dev::eth::Instruction::MLOAD, *_value))
+			if (*key != name)
+				m_memory[*key] = name;
+	}
 }
 
 void DataFlowAnalyzer::pushScope(bool _functionScope)
@@ -201,6 +279,14 @@ void DataFlowAnalyzer::clearValues(set<YulString> _variables)
 		for (auto const& ref: m_referencedBy[name])
 			_variables.emplace(ref);
 
+	// Clear knowledge about storage and memory that refers to these variables.
+	for (auto* knowledge: {&m_storage, &m_memory})
+		for (auto it = knowledge->begin(); it != knowledge->end();)
+			if (_variables.count(it->first) || _variables.count(it->second))
+				it = knowledge->erase(it);
+			else
+				++it;
+
 	// Clear the value and update the reference relation.
 	for (auto const& name: _variables)
 		m_value.erase(name);
@@ -223,3 +309,125 @@ bool DataFlowAnalyzer::inScope(YulString _variableName) const
 	}
 	return false;
 }
+
+void DataFlowAnalyzer::clearKnowledgeIfInvalidated(Expression const& _expression)
+{
+	InvalidationChecker checker{m_dialect};
+	checker.visit(_expression);
+	if (checker.invalidatesStorage())
+		m_storage.clear();
+	if (checker.invalidatesMemory())
+		m_memory.clear();
+}
+
+void DataFlowAnalyzer::clearKnowledgeIfInvalidated(Block const& _block)
+{
+	InvalidationChecker checker{m_dialect};
+	checker(_block);
+	if (checker.invalidatesStorage())
+		m_storage.clear();
+	if (checker.invalidatesMemory())
+		m_memory.clear();
+}
+
+void DataFlowAnalyzer::joinKnowledge(
+	map<YulString, YulString> const& _olderStorage,
+	map<YulString, YulString> const& _olderMemory
+)
+{
+	auto join = [](map<YulString, YulString>& _knowledge, map<YulString, YulString> const& _older)
+	{
+		for (auto it = _knowledge.begin(); it != _knowledge.end();)
+		{
+			auto older = _older.find(it->first);
+			if (older == _older.end() || older->second != it->second)
+				it = _knowledge.erase(it);
+			else
+				++it;
+		}
+	};
+	join(m_storage, _olderStorage);
+	join(m_memory, _olderMemory);
+}
+
+boost::optional<YulString> DataFlowAnalyzer::knownLoadValue(dev::eth::Instruction _load, YulString _key) const
+{
+	map<YulString, YulString> const& knowledge = _load == dev::eth::Instruction::SLOAD ? m_storage : m_memory;
+	auto it = knowledge.find(_key);
+	if (it != knowledge.end())
+		return it->second;
+	for (auto const& item: knowledge)
+		if (knownToBeEqual(_key, item.first))
+			return item.second;
+	return {};
+}
+
+boost::optional<pair<YulString, YulString>> DataFlowAnalyzer::isSimpleStore(
+	dev::eth::Instruction _store,
+	ExpressionStatement const& _statement
+)
+{
+	if (_statement.expression.type() == typeid(FunctionalInstruction))
+	{
+		FunctionalInstruction const& instruction = boost::get<FunctionalInstruction>(_statement.expression);
+		if (
+			instruction.instruction == _store &&
+			instruction.arguments.at(0).type() == typeid(Identifier) &&
+			instruction.arguments.at(1).type() == typeid(Identifier)
+		)
+			return make_pair(
+				boost::get<Identifier>(instruction.arguments.at(0)).name,
+				boost::get<Identifier>(instruction.arguments.at(1)).name
+			);
+	}
+	return {};
+}
+
+boost::optional<YulString> DataFlowAnalyzer::isSimpleLoad(
+	dev::eth::Instruction _load,
+	Expression const& _expression
+)
+{
+	if (_expression.type() == typeid(FunctionalInstruction))
+	{
+		FunctionalInstruction const& instruction = boost::get<FunctionalInstruction>(_expression);
+		if (instruction.instruction == _load && instruction.arguments.at(0).type() == typeid(Identifier))
+			return boost::get<Identifier>(instruction.arguments.at(0)).name;
+	}
+	return {};
+}
+
+boost::optional<u256> DataFlowAnalyzer::knownConstant(YulString _variable) const
+{
+	auto it = m_value.find(_variable);
+	if (it != m_value.end() && it->second->type() == typeid(Literal))
+	{
+		Literal const& literal = boost::get<Literal>(*it->second);
+		if (literal.kind == LiteralKind::Number)
+			return valueOfNumberLiteral(literal);
+	}
+	return {};
+}
+
+bool DataFlowAnalyzer::knownToBeEqual(YulString _a, YulString _b) const
+{
+	if (_a == _b)
+		return true;
+	auto a = knownConstant(_a);
+	auto b = knownConstant(_b);
+	return a && b && *a == *b;
+}
+
+bool DataFlowAnalyzer::knownToBeDifferent(YulString _a, YulString _b) const
+{
+	auto a = knownConstant(_a);
+	auto b = knownConstant(_b);
+	return a && b && *a != *b;
+}
+
+bool DataFlowAnalyzer::knownToBeDifferentByAtLeast32(YulString _a, YulString _b) const
+{
+	auto a = knownConstant(_a);
+	auto b = knownConstant(_b);
+	return a && b && u256(*a - *b) >= 32 && u256(*b - *a) >= 32;
+}
@@ -25,6 +25,12 @@
 #include <libyul/optimiser/ASTWalker.h>
 #include <libyul/YulString.h>
 
+#include <libevmasm/Instruction.h>
+
+#include <libdevcore/Common.h>
+
+#include <boost/optional.hpp>
+
 #include <map>
 #include <set>
 
@@ -39,6 +45,11 @@ struct Dialect;
  *
  * A special zero constant expression is used for the default value of variables.
  *
+ * It also tracks which variables hold the current contents of storage and memory at
+ * the location given by other variables, as written by ``sstore`` and ``mstore`` or read
+ * by ``sload`` and ``mload``. This knowledge is cleared conservatively by function calls
+ * and all other operations that can modify storage or memory.
+ *
  * Prerequisite: Disambiguator, ForLoopInitRewriter.
  */
 class DataFlowAnalyzer: public ASTModifier
@@ -47,6 +58,7 @@ public:
 	explicit DataFlowAnalyzer(Dialect const& _dialect): m_dialect(_dialect) {}
 
 	using ASTModifier::operator();
+	void operator()(ExpressionStatement& _statement) override;
 	void operator()(Assignment& _assignment) override;
 	void operator()(VariableDeclaration& _varDecl) override;
 	void operator()(If& _if) override;
@@ -72,6 +84,40 @@ protected:
 	/// Returns true iff the variable is in scope.
 	bool inScope(YulString _variableName) const;
 
+	/// Clears knowledge about storage or memory if they may be modified inside the expression.
+	void clearKnowledgeIfInvalidated(Expression const& _expression);
+	/// Clears knowledge about storage or memory if they may be modified inside the block.
+	void clearKnowledgeIfInvalidated(Block const& _block);
+	/// Retains only the knowledge about storage and memory that is also present in the
+	/// given previous knowledge, for example at points where control flow is merged.
+	void joinKnowledge(
+		std::map<YulString, YulString> const& _olderStorage,
+		std::map<YulString, YulString> const& _olderMemory
+	);
+
+	/// @returns the variable holding the current contents of storage (for ``sload``) or
+	/// memory (for ``mload``) at the location @a _key, if known.
+	boost::optional<YulString> knownLoadValue(dev::eth::Instruction _load, YulString _key) const;
+
+	/// @returns the key and value variables if @a _statement is ``sstore(key, value)`` or
+	/// ``mstore(key, value)`` (depending on @a _store) with identifiers as arguments.
+	static boost::optional<std::pair<YulString, YulString>> isSimpleStore(
+		dev::eth::Instruction _store,
+		ExpressionStatement const& _statement
+	);
+	/// @returns the key variable if @a _expression is ``sload(key)`` or ``mload(key)``
+	/// (depending on @a _load) with an identifier as argument.
+	static boost::optional<YulString> isSimpleLoad(
+		dev::eth::Instruction _load,
+		Expression const& _expression
+	);
+
+	/// @returns the value of the variable if it is known to be a number literal.
+	boost::optional<dev::u256> knownConstant(YulString _variable) const;
+	bool knownToBeEqual(YulString _a, YulString _b) const;
+	bool knownToBeDifferent(YulString _a, YulString _b) const;
+	bool knownToBeDifferentByAtLeast32(YulString _a, YulString _b) const;
+
 	/// Current values of variables, always movable.
 	std::map<YulString, Expression const*> m_value;
 	/// m_references[a].contains(b) <=> the current expression assigned to a references b
@@ -79,6 +125,11 @@ protected:
 	/// m_referencedBy[b].contains(a) <=> the current expression assigned to a references b
 	std::map<YulString, std::set<YulString>> m_referencedBy;
 
+	/// m_storage[a] == b <=> the storage slot a (a variable) currently holds the value of variable b
+	std::map<YulString, YulString> m_storage;
+	/// m_memory[a] == b <=> the memory word at a (a variable) currently holds the value of variable b
+	std::map<YulString, YulString> m_memory;
+
 	struct Scope
 	{
 		explicit Scope(bool _isFunction): isFunction(_isFunction) {}
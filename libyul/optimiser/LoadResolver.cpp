@@ -0,0 +1,45 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Optimisation stage that replaces loads from storage and memory by the value
+ * currently stored at that location, if it is known.
+ */
+
+#include <libyul/optimiser/LoadResolver.h>
+
+#include <libyul/Exceptions.h>
+#include <libyul/AsmData.h>
+
+using namespace std;
+using namespace dev;
+using namespace yul;
+
+void LoadResolver::visit(Expression& _e)
+{
+	DataFlowAnalyzer::visit(_e);
+
+	for (auto load: {eth::Instruction::SLOAD, eth::Instruction::MLOAD})
+		if (auto key = isSimpleLoad(load, _e))
+		{
+			if (auto value = knownLoadValue(load, *key))
+			{
+				assertThrow(inScope(*value), OptimizerException, "");
+				_e = Identifier{locationOf(_e), *value};
+			}
+			break;
+		}
+}
@@ -0,0 +1,50 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Optimisation stage that replaces loads from storage and memory by the value
+ * currently stored at that location, if it is known.
+ */
+
+#pragma once
+
+#include <libyul/optimiser/DataFlowAnalyzer.h>
+
+namespace yul
+{
+
+struct Dialect;
+
+/**
+ * Optimisation stage that replaces expressions of the form ``sload(x)`` and ``mload(x)``
+ * by a variable that currently holds the value stored in storage or memory at location ``x``,
+ * as tracked by the Dataflow Analyzer.
+ *
+ * Works best if the code is in SSA form and expressions are split.
+ *
+ * Prerequisite: Disambiguator, ForLoopInitRewriter.
+ */
+class LoadResolver: public DataFlowAnalyzer
+{
+public:
+	LoadResolver(Dialect const& _dialect): DataFlowAnalyzer(_dialect) {}
+
+protected:
+	using ASTModifier::visit;
+	void visit(Expression& _e) override;
+};
+
+}
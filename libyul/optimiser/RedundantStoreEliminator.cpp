@@ -0,0 +1,146 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Optimisation stage that removes stores to storage and memory that are overwritten
+ * before they are read or that store the value already present.
+ */
+
+#include <libyul/optimiser/RedundantStoreEliminator.h>
+
+#include <libyul/optimiser/OptimizerUtilities.h>
+#include <libyul/optimiser/Semantics.h>
+#include <libyul/AsmData.h>
+
+using namespace std;
+using namespace dev;
+using namespace yul;
+
+void RedundantStoreEliminator::operator()(Block& _block)
+{
+	findOverwrittenStores(_block);
+	DataFlowAnalyzer::operator()(_block);
+	removeEmptyBlocks(_block);
+}
+
+void RedundantStoreEliminator::visit(Statement& _statement)
+{
+	if (m_overwrittenStores.erase(&_statement) || storesKnownValue(_statement))
+	{
+		// The store is not registered with the data flow analysis,
+		// since it is not performed anymore.
+		ExpressionStatement& exprStmt = boost::get<ExpressionStatement>(_statement);
+		_statement = Block{std::move(exprStmt.location), {}};
+	}
+	else
+		DataFlowAnalyzer::visit(_statement);
+}
+
+void RedundantStoreEliminator::findOverwrittenStores(Block const& _block)
+{
+	for (size_t i = 0; i < _block.statements.size(); ++i)
+	{
+		Statement const& statement = _block.statements[i];
+		if (statement.type() != typeid(ExpressionStatement))
+			continue;
+		Expression const& expression = boost::get<ExpressionStatement>(statement).expression;
+		if (expression.type() != typeid(FunctionalInstruction))
+			continue;
+		FunctionalInstruction const& instruction = boost::get<FunctionalInstruction>(expression);
+		if (
+			(instruction.instruction == eth::Instruction::SSTORE || instruction.instruction == eth::Instruction::MSTORE) &&
+			instruction.arguments.at(0).type() == typeid(Identifier) &&
+			movableArguments(instruction) &&
+			overwrittenLater(_block, i, instruction.instruction, boost::get<Identifier>(instruction.arguments.at(0)).name)
+		)
+			m_overwrittenStores.insert(&statement);
+	}
+}
+
+bool RedundantStoreEliminator::overwrittenLater(
+	Block const& _block,
+	size_t _index,
+	eth::Instruction _store,
+	YulString _key
+) const
+{
+	for (size_t i = _index + 1; i < _block.statements.size(); ++i)
+	{
+		Statement const& statement = _block.statements[i];
+		if (statement.type() == typeid(ExpressionStatement))
+		{
+			// Stores only write, so they cannot observe the stored value.
+			Expression const& expression = boost::get<ExpressionStatement>(statement).expression;
+			if (expression.type() != typeid(FunctionalInstruction))
+				return false;
+			FunctionalInstruction const& instruction = boost::get<FunctionalInstruction>(expression);
+			if (
+				(instruction.instruction != eth::Instruction::SSTORE && instruction.instruction != eth::Instruction::MSTORE) ||
+				!movableArguments(instruction)
+			)
+				return false;
+			if (
+				instruction.instruction == _store &&
+				instruction.arguments.at(0).type() == typeid(Identifier) &&
+				boost::get<Identifier>(instruction.arguments.at(0)).name == _key
+			)
+				return true;
+		}
+		else if (statement.type() == typeid(VariableDeclaration))
+		{
+			VariableDeclaration const& varDecl = boost::get<VariableDeclaration>(statement);
+			if (varDecl.value && !MovableChecker{m_dialect, *varDecl.value}.movable())
+				return false;
+		}
+		else if (statement.type() == typeid(Assignment))
+		{
+			Assignment const& assignment = boost::get<Assignment>(statement);
+			if (!MovableChecker{m_dialect, *assignment.value}.movable())
+				return false;
+			for (auto const& var: assignment.variableNames)
+				if (var.name == _key)
+					return false;
+		}
+		else
+			return false;
+	}
+	return false;
+}
+
+bool RedundantStoreEliminator::storesKnownValue(Statement const& _statement) const
+{
+	if (_statement.type() != typeid(ExpressionStatement))
+		return false;
+	ExpressionStatement const& exprStmt = boost::get<ExpressionStatement>(_statement);
+	for (auto store: {eth::Instruction::SSTORE, eth::Instruction::MSTORE})
+		if (auto vars = isSimpleStore(store, exprStmt))
+		{
+			auto value = knownLoadValue(
+				store == eth::Instruction::SSTORE ? eth::Instruction::SLOAD : eth::Instruction::MLOAD,
+				vars->first
+			);
+			return value && knownToBeEqual(*value, vars->second);
+		}
+	return false;
+}
+
+bool RedundantStoreEliminator::movableArguments(FunctionalInstruction const& _instruction) const
+{
+	for (auto const& argument: _instruction.arguments)
+		if (!MovableChecker{m_dialect, argument}.movable())
+			return false;
+	return true;
+}
@@ -0,0 +1,74 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Optimisation stage that removes stores to storage and memory that are overwritten
+ * before they are read or that store the value already present.
+ */
+
+#pragma once
+
+#include <libyul/optimiser/DataFlowAnalyzer.h>
+
+#include <set>
+
+namespace yul
+{
+
+struct Dialect;
+
+/**
+ * Optimisation stage that removes expression statements of the form ``sstore(x, y)`` and
+ * ``mstore(x, y)`` where
+ *  - the location ``x`` is known to already hold the value ``y`` according to the
+ *    Dataflow Analyzer, or
+ *  - a later statement in the same block stores to the same location ``x`` and all
+ *    statements in between are assignments of movable expressions or stores with
+ *    movable arguments, i.e. nothing can read storage or memory or stop execution
+ *    before the location is overwritten.
+ *
+ * Works best if the code is in SSA form and expressions are split.
+ *
+ * Prerequisite: Disambiguator, ForLoopInitRewriter.
+ */
+class RedundantStoreEliminator: public DataFlowAnalyzer
+{
+public:
+	RedundantStoreEliminator(Dialect const& _dialect): DataFlowAnalyzer(_dialect) {}
+
+	using DataFlowAnalyzer::operator();
+	void operator()(Block& _block) override;
+
+protected:
+	using ASTModifier::visit;
+	void visit(Statement& _statement) override;
+
+private:
+	/// Registers all stores in @a _block that are overwritten later in the block
+	/// before their location can be read.
+	void findOverwrittenStores(Block const& _block);
+	/// @returns true if the statement at @a _index in @a _block (with movable arguments)
+	/// stores to @a _key using @a _store and a later statement in the block overwrites it.
+	bool overwrittenLater(Block const& _block, size_t _index, dev::eth::Instruction _store, YulString _key) const;
+	/// @returns true if @a _statement stores a value already present at its location.
+	bool storesKnownValue(Statement const& _statement) const;
+	/// @returns true if all arguments of @a _instruction are movable.
+	bool movableArguments(FunctionalInstruction const& _instruction) const;
+
+	std::set<Statement const*> m_overwrittenStores;
+};
+
+}
@@ -72,3 +72,23 @@ void MovableChecker::visit(Statement const&)
 {
 	assertThrow(false, OptimizerException, "Movability for statement requested.");
 }
+
+void InvalidationChecker::operator()(FunctionalInstruction const& _instr)
+{
+	ASTWalker::operator()(_instr);
+	if (eth::SemanticInformation::invalidatesStorage(_instr.instruction))
+		m_invalidatesStorage = true;
+	if (eth::SemanticInformation::invalidatesMemory(_instr.instruction))
+		m_invalidatesMemory = true;
+}
+
+void InvalidationChecker::operator()(FunctionCall const& _functionCall)
+{
+	ASTWalker::operator()(_functionCall);
+	BuiltinFunction const* f = m_dialect.builtin(_functionCall.functionName.name);
+	if (!f || !f->movable)
+	{
+		m_invalidatesStorage = true;
+		m_invalidatesMemory = true;
+	}
+}
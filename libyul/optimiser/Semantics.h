@@ -56,4 +56,27 @@ private:
 	bool m_movable = true;
 };
 
+/**
+ * Specific AST walker that determines whether an expression or statement
+ * can modify storage or memory.
+ * Calls to functions that are not movable builtins are assumed to modify both.
+ */
+class InvalidationChecker: public ASTWalker
+{
+public:
+	explicit InvalidationChecker(Dialect const& _dialect): m_dialect(_dialect) {}
+
+	using ASTWalker::operator();
+	void operator()(FunctionalInstruction const& _functionalInstruction) override;
+	void operator()(FunctionCall const& _functionCall) override;
+
+	bool invalidatesStorage() const { return m_invalidatesStorage; }
+	bool invalidatesMemory() const { return m_invalidatesMemory; }
+
+private:
+	Dialect const& m_dialect;
+	bool m_invalidatesStorage = false;
+	bool m_invalidatesMemory = false;
+};
+
 }
@@ -42,7 +42,7 @@ public:
 	/// Try to remove local variables until the AST is compilable.
 	/// @returns true if it was successful.
 	static bool run(
-		std::shared_ptr<Dialect> const& _dialect,
+		std::shared_ptr<Dialect const> const& _dialect,
 		Block& _ast,
 		bool _optimizeStackAllocation,
 		size_t _maxIterations
@@ -32,6 +32,7 @@
 #include <libyul/optimiser/ExpressionInliner.h>
 #include <libyul/optimiser/FullInliner.h>
 #include <libyul/optimiser/ForLoopInitRewriter.h>
+#include <libyul/optimiser/LoadResolver.h>
 #include <libyul/optimiser/Rematerialiser.h>
 #include <libyul/optimiser/UnusedPruner.h>
 #include <libyul/optimiser/ExpressionSimplifier.h>
@@ -41,6 +42,7 @@
 #include <libyul/optimiser/StackCompressor.h>
 #include <libyul/optimiser/StructuralSimplifier.h>
 #include <libyul/optimiser/RedundantAssignEliminator.h>
+#include <libyul/optimiser/RedundantStoreEliminator.h>
 #include <libyul/optimiser/VarNameCleaner.h>
 #include <libyul/optimiser/Metrics.h>
 #include <libyul/AsmAnalysis.h>
@@ -57,7 +59,7 @@ using namespace dev;
 using namespace yul;
 
 void OptimiserSuite::run(
-	shared_ptr<Dialect> const& _dialect,
+	shared_ptr<Dialect const> const& _dialect,
 	Block& _ast,
 	AsmAnalysisInfo const& _analysisInfo,
 	bool _optimizeStackAllocation,
@@ -103,6 +105,7 @@ void OptimiserSuite::run(
 
 			ExpressionSimplifier::run(*_dialect, ast);
 			CommonSubexpressionEliminator{*_dialect}(ast);
+			LoadResolver{*_dialect}(ast);
 		}
 
 		{
@@ -110,6 +113,7 @@ void OptimiserSuite::run(
 			StructuralSimplifier{*_dialect}(ast);
 			BlockFlattener{}(ast);
 			DeadCodeEliminator{}(ast);
+			RedundantStoreEliminator{*_dialect}(ast);
 			UnusedPruner::runUntilStabilised(*_dialect, ast, reservedIdentifiers);
 		}
 		{
@@ -163,6 +167,7 @@ void OptimiserSuite::run(
 			BlockFlattener{}(ast);
 			DeadCodeEliminator{}(ast);
 			CommonSubexpressionEliminator{*_dialect}(ast);
+			LoadResolver{*_dialect}(ast);
 			SSATransform::run(ast, dispenser);
 			RedundantAssignEliminator::run(*_dialect, ast);
 			RedundantAssignEliminator::run(*_dialect, ast);
@@ -28,6 +28,7 @@
 #include <libsolidity/interface/Version.h>
 #include <libsolidity/parsing/Parser.h>
 #include <libsolidity/ast/ASTPrinter.h>
+#include <libsolidity/ast/ASTBinaryConverter.h>
 #include <libsolidity/ast/ASTJsonConverter.h>
 #include <libsolidity/analysis/NameAndTypeResolver.h>
 #include <libsolidity/interface/CompilerStack.h>
@@ -101,12 +102,14 @@ std::ostream& serr(bool _used = true)
 static string const g_stdinFileNameStr = "<stdin>";
 static string const g_strAbi = "abi";
 static string const g_strAllowPaths = "allow-paths";
+static string const g_strAnalysisJobs = "analysis-jobs";
 static string const g_strAsm = "asm";
 static string const g_strAsmJson = "asm-json";
 static string const g_strAssemble = "assemble";
 static string const g_strAst = "ast";
 static string const g_strAstJson = "ast-json";
 static string const g_strAstCompactJson = "ast-compact-json";
+static string const g_strAstBinary = "ast-binary";
 static string const g_strBinary = "bin";
 static string const g_strBinaryRuntime = "bin-runtime";
 static string const g_strCombinedJson = "combined-json";
@@ -137,7 +140,9 @@ static string const g_strOptimizeYul = "optimize-yul";
 static string const g_strOutputDir = "output-dir";
 static string const g_strOverwrite = "overwrite";
 static string const g_strSignatureHashes = "hashes";
+static string const g_strSMTCheckerJobs = "smtchecker-jobs";
 static string const g_strSources = "sources";
+static string const g_strViaIR = "experimental-via-ir";
 static string const g_strSourceList = "sourceList";
 static string const g_strSrcMap = "srcmap";
 static string const g_strSrcMapRuntime = "srcmap-runtime";
@@ -153,11 +158,13 @@ static string const g_strNewReporter = "new-reporter";
 static string const g_argAbi = g_strAbi;
 static string const g_argPrettyJson = g_strPrettyJson;
 static string const g_argAllowPaths = g_strAllowPaths;
+static string const g_argAnalysisJobs = g_strAnalysisJobs;
 static string const g_argAsm = g_strAsm;
 static string const g_argAsmJson = g_strAsmJson;
 static string const g_argAssemble = g_strAssemble;
 static string const g_argAst = g_strAst;
 static string const g_argAstCompactJson = g_strAstCompactJson;
+static string const g_argAstBinary = g_strAstBinary;
 static string const g_argAstJson = g_strAstJson;
 static string const g_argBinary = g_strBinary;
 static string const g_argBinaryRuntime = g_strBinaryRuntime;
@@ -180,6 +187,7 @@ static string const g_argOptimize = g_strOptimize;
 static string const g_argOptimizeRuns = g_strOptimizeRuns;
 static string const g_argOutputDir = g_strOutputDir;
 static string const g_argSignatureHashes = g_strSignatureHashes;
+static string const g_argSMTCheckerJobs = g_strSMTCheckerJobs;
 static string const g_argStandardJSON = g_strStandardJSON;
 static string const g_argStrictAssembly = g_strStrictAssembly;
 static string const g_argVersion = g_strVersion;
@@ -581,7 +589,8 @@ void CommandLineInterface::createFile(string const& _fileName, string const& _da
 		m_error = true;
 		return;
 	}
-	ofstream outFile(pathName);
+	// Binary mode, so that binary outputs are written unchanged.
+	ofstream outFile(pathName, ios::out | ios::binary);
 	outFile << _data;
 	if (!outFile)
 		BOOST_THROW_EXCEPTION(FileError() << errinfo_comment("Could not write to file: " + pathName));
@@ -633,6 +642,7 @@ Allowed options)",
 			"Lower values will optimize more for initial deployment cost, higher values will optimize more for high-frequency usage."
 		)
 		(g_strOptimizeYul.c_str(), "Enable Yul optimizer in Solidity, mostly for ABIEncoderV2. Still considered experimental.")
+		(g_strViaIR.c_str(), "Generate the bytecode from the optimized Yul IR instead of using the legacy code generator (EXPERIMENTAL).")
 		(g_argPrettyJson.c_str(), "Output JSON in pretty format. Currently it only works with the combined JSON output.")
 		(
 			g_argLibraries.c_str(),
@@ -681,6 +691,18 @@ Allowed options)",
 			"and modify binaries in place."
 		)
 		(g_argMetadataLiteral.c_str(), "Store referenced sources are literal data in the metadata output.")
+		(
+			g_argSMTCheckerJobs.c_str(),
+			po::value<unsigned>()->value_name("n")->default_value(1),
+			"Number of threads the SMTChecker uses to verify functions concurrently. "
+			"Use 0 for the number of available hardware threads."
+		)
+		(
+			g_argAnalysisJobs.c_str(),
+			po::value<unsigned>()->value_name("n")->default_value(1),
+			"Number of threads used to analyze source files and type check contracts concurrently. "
+			"Use 0 for the number of available hardware threads."
+		)
 		(
 			g_argAllowPaths.c_str(),
 			po::value<string>()->value_name("path(s)"),
@@ -695,6 +717,7 @@ Allowed options)",
 		(g_argAst.c_str(), "AST of all source files.")
 		(g_argAstJson.c_str(), "AST of all source files in JSON format.")
 		(g_argAstCompactJson.c_str(), "AST of all source files in a compact JSON format.")
+		(g_argAstBinary.c_str(), "AST of all source files in a binary encoding of the compact JSON format (hex encoded on stdout).")
 		(g_argAsm.c_str(), "EVM assembly of the contracts.")
 		(g_argAsmJson.c_str(), "EVM assembly of the contracts in JSON format.")
 		(g_argOpcodes.c_str(), "Opcodes of the contracts.")
@@ -922,9 +945,12 @@ bool CommandLineInterface::processInput()
 		if (m_args.count(g_argLibraries))
 			m_compiler->setLibraries(m_libraries);
 		m_compiler->setEVMVersion(m_evmVersion);
+		m_compiler->setSMTCheckerJobs(m_args[g_argSMTCheckerJobs].as<unsigned>());
+		m_compiler->setAnalysisJobs(m_args[g_argAnalysisJobs].as<unsigned>());
 		// TODO: Perhaps we should not compile unless requested
 
 		m_compiler->enableIRGeneration(m_args.count(g_argIR));
+		m_compiler->enableCodeGenerationViaIR(m_args.count(g_strViaIR));
 
 		OptimiserSettings settings = m_args.count(g_argOptimize) ? OptimiserSettings::standard() : OptimiserSettings::minimal();
 		settings.expectedExecutionsPerDeployment = m_args[g_argOptimizeRuns].as<unsigned>();
@@ -1078,6 +1104,8 @@ void CommandLineInterface::handleAst(string const& _argStr)
 		title = "JSON AST:";
 	else if (_argStr == g_argAstCompactJson)
 		title = "JSON AST (compact format):";
+	else if (_argStr == g_argAstBinary)
+		title = "Binary AST:";
 	else
 		BOOST_THROW_EXCEPTION(InternalCompilerError() << errinfo_comment("Illegal argStr for AST"));
 
@@ -1114,6 +1142,11 @@ void CommandLineInterface::handleAst(string const& _argStr)
 					ASTPrinter printer(m_compiler->ast(sourceCode.first), sourceCode.second);
 					printer.print(data);
 				}
+				else if (_argStr == g_argAstBinary)
+				{
+					data << asString(ASTBinaryConverter(m_compiler->sourceIndices()).toBinary(m_compiler->ast(sourceCode.first)));
+					postfix += "_bin";
+				}
 				else
 				{
 					ASTJsonConverter(legacyFormat, m_compiler->sourceIndices()).print(data, m_compiler->ast(sourceCode.first));
@@ -1138,6 +1171,8 @@ void CommandLineInterface::handleAst(string const& _argStr)
 					);
 					printer.print(sout());
 				}
+				else if (_argStr == g_argAstBinary)
+					sout() << toHex(ASTBinaryConverter(m_compiler->sourceIndices()).toBinary(m_compiler->ast(sourceCode.first))) << endl;
 				else
 					ASTJsonConverter(legacyFormat, m_compiler->sourceIndices()).print(sout(), m_compiler->ast(sourceCode.first));
 			}
@@ -1352,6 +1387,7 @@ void CommandLineInterface::outputCompilationResults()
 	handleAst(g_argAst);
 	handleAst(g_argAstJson);
 	handleAst(g_argAstCompactJson);
+	handleAst(g_argAstBinary);
 
 	vector<string> contracts = m_compiler->contractNames();
 	for (string const& contract: contracts)
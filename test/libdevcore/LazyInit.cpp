@@ -0,0 +1,133 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the lazily initialised caches in LazyInit.h.
+ */
+
+#include <libdevcore/LazyInit.h>
+#include <libdevcore/Parallel.h>
+
+#include <test/Options.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+namespace dev
+{
+namespace test
+{
+
+namespace
+{
+/// Number of threads racing for the first query of a cache.
+unsigned constexpr c_threads = 8;
+
+/// Calls @a _query on c_threads threads that are released at the same time.
+template <class Query>
+void race(Query const& _query)
+{
+	atomic<unsigned> waiting{c_threads};
+	parallelFor(c_threads, c_threads, [&](size_t _index, unsigned)
+	{
+		--waiting;
+		while (waiting > 0)
+			this_thread::yield();
+		_query(_index);
+	});
+}
+}
+
+BOOST_AUTO_TEST_SUITE(LazyInitTest)
+
+BOOST_AUTO_TEST_CASE(computes_once_per_value)
+{
+	LazyInit<string> value;
+	BOOST_CHECK(!value.peek());
+	unsigned calls = 0;
+	string const& first = value.get([&]() { ++calls; return string("abc"); });
+	string const& second = value.get([&]() { ++calls; return string("def"); });
+	BOOST_CHECK_EQUAL(first, "abc");
+	BOOST_CHECK_EQUAL(&first, &second);
+	BOOST_CHECK_EQUAL(value.peek(), &first);
+	BOOST_CHECK_EQUAL(calls, 1);
+
+	LazyInit<string> copy(value);
+	BOOST_CHECK(!copy.peek());
+	value.reset();
+	BOOST_CHECK(!value.peek());
+	BOOST_CHECK_EQUAL(value.get([]() { return string("def"); }), "def");
+}
+
+BOOST_AUTO_TEST_CASE(map_computes_once_per_key)
+{
+	LazyInitMap<int, string> map;
+	unsigned calls = 0;
+	string const& one = map.get(1, [&]() { ++calls; return string("one"); });
+	string const& two = map.get(2, [&]() { ++calls; return string("two"); });
+	BOOST_CHECK_EQUAL(one, "one");
+	BOOST_CHECK_EQUAL(two, "two");
+	BOOST_CHECK_EQUAL(&map.get(1, [&]() { ++calls; return string(); }), &one);
+	BOOST_CHECK_EQUAL(calls, 2);
+	map.clear();
+	BOOST_CHECK_EQUAL(map.get(1, []() { return string("uno"); }), "uno");
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_get)
+{
+	for (unsigned round = 0; round < 50; ++round)
+	{
+		LazyInit<string> value;
+		vector<string const*> results(c_threads);
+		race([&](size_t _index)
+		{
+			results[_index] = &value.get([&]() { return to_string(_index); });
+		});
+		// Every thread has to see the value that was published first.
+		for (string const* result: results)
+			BOOST_REQUIRE_EQUAL(result, value.peek());
+	}
+}
+
+BOOST_AUTO_TEST_CASE(map_concurrent_get)
+{
+	for (unsigned round = 0; round < 50; ++round)
+	{
+		LazyInitMap<size_t, string> map;
+		// Two threads per key, so that both racing on the same key and
+		// on different keys is covered.
+		vector<string const*> results(c_threads);
+		race([&](size_t _index)
+		{
+			results[_index] = &map.get(_index % (c_threads / 2), [&]() { return to_string(_index); });
+		});
+		for (size_t i = 0; i < c_threads; ++i)
+		{
+			string const& expectation = map.get(i % (c_threads / 2), []() { return string(); });
+			BOOST_REQUIRE_EQUAL(results[i], &expectation);
+			BOOST_REQUIRE_EQUAL(stoul(expectation) % (c_threads / 2), i % (c_threads / 2));
+		}
+	}
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
+}
@@ -0,0 +1,59 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Unit tests for the CharStream class.
+ */
+
+#include <liblangutil/CharStream.h>
+
+#include <test/Options.h>
+
+using namespace std;
+
+namespace langutil
+{
+namespace test
+{
+
+BOOST_AUTO_TEST_SUITE(CharStreamTest)
+
+BOOST_AUTO_TEST_CASE(position_to_line_column)
+{
+	CharStream const stream("ab\ncd\n\nef", "source");
+
+	BOOST_CHECK((stream.translatePositionToLineColumn(0) == make_tuple(0, 0)));
+	BOOST_CHECK((stream.translatePositionToLineColumn(2) == make_tuple(0, 2)));
+	BOOST_CHECK((stream.translatePositionToLineColumn(3) == make_tuple(1, 0)));
+	BOOST_CHECK((stream.translatePositionToLineColumn(6) == make_tuple(2, 0)));
+	BOOST_CHECK((stream.translatePositionToLineColumn(8) == make_tuple(3, 1)));
+	// Positions beyond the end are clamped to the end.
+	BOOST_CHECK((stream.translatePositionToLineColumn(100) == make_tuple(3, 2)));
+}
+
+BOOST_AUTO_TEST_CASE(positions_to_line_columns)
+{
+	CharStream const stream("ab\ncd\n\nef", "source");
+
+	vector<tuple<int, int>> const expectation{{1, 1}, {0, 0}, {3, 0}};
+	BOOST_CHECK((stream.translatePositionsToLineColumns({4, 0, 7}) == expectation));
+	BOOST_CHECK((CharStream("", "empty").translatePositionsToLineColumns({0}) == vector<tuple<int, int>>{make_tuple(0, 0)}));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
+} // end namespaces
@@ -18,6 +18,7 @@
 #include <test/libsolidity/ASTJSONTest.h>
 #include <test/Options.h>
 #include <libdevcore/AnsiColorized.h>
+#include <libsolidity/ast/ASTBinaryConverter.h>
 #include <libsolidity/ast/ASTJsonConverter.h>
 #include <libsolidity/interface/CompilerStack.h>
 #include <boost/algorithm/string.hpp>
@@ -137,6 +138,18 @@ bool ASTJSONTest::run(ostream& _stream, string const& _linePrefix, bool const _f
 		resultsMatch = false;
 	}
 
+	for (auto const& source: m_sources)
+	{
+		// The binary format has to decode to exactly the compact JSON format.
+		Json::Value json = ASTJsonConverter(false, sourceIndices).toJson(c.ast(source.first));
+		if (ASTBinaryConverter::decode(ASTBinaryConverter(sourceIndices).toBinary(c.ast(source.first))) != json)
+		{
+			AnsiColorized(_stream, _formatted, {BOLD, RED}) << _linePrefix <<
+				"Binary AST of source \"" << source.first << "\" does not decode to the JSON AST." << endl;
+			resultsMatch = false;
+		}
+	}
+
 	for (size_t i = 0; i < m_sources.size(); i++)
 	{
 		ostringstream result;
@@ -141,6 +141,106 @@ BOOST_AUTO_TEST_CASE(single_callvaluecheck)
 	BOOST_CHECK_EQUAL(bytecodeSizePayable - bytecodeSizeNonpayable, 26);
 }
 
+BOOST_AUTO_TEST_CASE(temporary_memory_reuse)
+{
+	char const* sourceCode = R"(
+		contract C {
+			event E(bytes data);
+			function hashChain(uint n) public pure returns (bytes32 h) {
+				for (uint i = 0; i < n; ++i)
+					h = keccak256(abi.encodePacked(h, i));
+			}
+			function log(uint n) public {
+				for (uint i = 0; i < n; ++i)
+				{
+					bytes32 h = keccak256(abi.encode(i, new uint[](4)));
+					emit E(abi.encode(h));
+				}
+			}
+		}
+	)";
+	m_optimiserSettings.reuseTemporaryMemory = false;
+	compileAndRun(sourceCode);
+	bytes hashChainResult = callContractFunction("hashChain(uint256)", 1000);
+	u256 hashChainGas = m_gasUsed;
+	callContractFunction("log(uint256)", 200);
+	u256 logGas = m_gasUsed;
+
+	m_optimiserSettings.reuseTemporaryMemory = true;
+	compileAndRun(sourceCode);
+	ABI_CHECK(callContractFunction("hashChain(uint256)", 1000), hashChainResult);
+	// Without reuse, memory grows by three words per iteration.
+	BOOST_CHECK_MESSAGE(
+		m_gasUsed + 5000 < hashChainGas,
+		"Gas used: " + m_gasUsed.str() + " - without memory reuse: " + hashChainGas.str()
+	);
+	ABI_CHECK(callContractFunction("log(uint256)", 200), encodeArgs());
+	BOOST_CHECK_MESSAGE(
+		m_gasUsed + 5000 < logGas,
+		"Gas used: " + m_gasUsed.str() + " - without memory reuse: " + logGas.str()
+	);
+}
+
+BOOST_AUTO_TEST_CASE(packed_struct_storage_writes)
+{
+	char const* sourceCode = R"(
+		contract C {
+			struct S { uint64 a; int32 b; bytes4 c; bool d; }
+			S s;
+			S t;
+			function init(uint64 x, int32 y, bytes4 z) public { s = S(x, y, z, true); }
+			function setOne(uint64 x) public { s.a = x; }
+			function setAll(uint64 x, int32 y, bytes4 z) public { s.a = x; s.b = y; s.c = z; s.d = true; }
+			function copy() public { t = s; }
+			function clear() public { delete s; }
+			function get() public view returns (uint64, int32, bytes4, bool) { return (s.a, s.b, s.c, s.d); }
+			function getCopy() public view returns (uint64, int32, bytes4, bool) { return (t.a, t.b, t.c, t.d); }
+		}
+	)";
+	for (bool optimize: {false, true})
+	{
+		m_optimiserSettings = optimize ? OptimiserSettings::standard() : OptimiserSettings::minimal();
+		compileAndRun(sourceCode);
+		// Initialise storage first, so that all measured writes change non-zero slots.
+		ABI_CHECK(callContractFunction("init(uint64,int32,bytes4)", 1, 1, "abcd"), encodeArgs());
+		ABI_CHECK(callContractFunction("copy()"), encodeArgs());
+		ABI_CHECK(callContractFunction("setOne(uint64)", 2), encodeArgs());
+		u256 setOneGas = m_gasUsed;
+		ABI_CHECK(callContractFunction("setAll(uint64,int32,bytes4)", 3, -3, "efgh"), encodeArgs());
+		u256 setAllGas = m_gasUsed;
+		ABI_CHECK(callContractFunction("get()"), encodeArgs(3, -3, "efgh", true));
+		ABI_CHECK(callContractFunction("init(uint64,int32,bytes4)", 4, -4, "ijkl"), encodeArgs());
+		u256 initGas = m_gasUsed;
+		ABI_CHECK(callContractFunction("get()"), encodeArgs(4, -4, "ijkl", true));
+		ABI_CHECK(callContractFunction("copy()"), encodeArgs());
+		u256 copyGas = m_gasUsed;
+		ABI_CHECK(callContractFunction("getCopy()"), encodeArgs(4, -4, "ijkl", true));
+		ABI_CHECK(callContractFunction("clear()"), encodeArgs());
+		u256 clearGas = m_gasUsed;
+		ABI_CHECK(callContractFunction("get()"), encodeArgs(0, 0, 0, false));
+
+		// The packed members of the struct are written with a single store.
+		BOOST_CHECK_MESSAGE(
+			initGas < setOneGas + 1000,
+			"Gas used: " + initGas.str() + " - single member update: " + setOneGas.str()
+		);
+		BOOST_CHECK_MESSAGE(
+			copyGas < setOneGas + 1000,
+			"Gas used: " + copyGas.str() + " - single member update: " + setOneGas.str()
+		);
+		BOOST_CHECK_MESSAGE(
+			clearGas < setOneGas + 1000,
+			"Gas used: " + clearGas.str() + " - single member update: " + setOneGas.str()
+		);
+		if (optimize)
+			// Consecutive member updates are combined by the optimiser.
+			BOOST_CHECK_MESSAGE(
+				setAllGas < setOneGas + 1000,
+				"Gas used: " + setAllGas.str() + " - single member update: " + setOneGas.str()
+			);
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -24,11 +24,18 @@
 #include <test/Options.h>
 
 #include <liblangutil/Exceptions.h>
+#include <liblangutil/SourceReferenceFormatter.h>
+#include <libsolidity/ast/AST.h>
+#include <libsolidity/ast/TypeProvider.h>
 #include <libsolidity/interface/CompilerStack.h>
 
+#include <libdevcore/Parallel.h>
+
 #include <boost/test/unit_test.hpp>
 
+#include <atomic>
 #include <string>
+#include <thread>
 
 using namespace std;
 
@@ -39,6 +46,32 @@ namespace solidity
 namespace test
 {
 
+namespace
+{
+/// Analyses @a _sources sequentially and with several jobs, checks that the
+/// errors do not depend on the number of jobs and @returns them.
+vector<string> checkConcurrentAnalysis(map<string, string> const& _sources)
+{
+	auto analyze = [&](unsigned _jobs)
+	{
+		CompilerStack c;
+		c.setAnalysisJobs(_jobs);
+		c.setSources(_sources);
+		c.setEVMVersion(dev::test::Options::get().evmVersion());
+		c.parseAndAnalyze();
+		vector<string> errors;
+		for (auto const& error: c.errors())
+			errors.push_back(langutil::SourceReferenceFormatter::formatErrorInformation(*error));
+		return errors;
+	};
+
+	vector<string> sequential = analyze(1);
+	BOOST_CHECK(analyze(4) == sequential);
+	BOOST_CHECK(analyze(0) == sequential);
+	return sequential;
+}
+}
+
 BOOST_AUTO_TEST_SUITE(SolidityImports)
 
 BOOST_AUTO_TEST_CASE(smoke_test)
@@ -542,6 +575,85 @@ BOOST_AUTO_TEST_CASE(inheritance_abi_encoder_match)
 	BOOST_CHECK_EQUAL(typeErrors, 0);
 }
 
+BOOST_AUTO_TEST_CASE(concurrent_analysis)
+{
+	map<string, string> sources;
+	for (size_t i = 0; i < 16; ++i)
+		sources["s" + to_string(i)] = R"(
+			import "s0";
+			/// @notice Only warnings, so that all analysis passes run.
+			contract C)" + to_string(i) + R"( {
+				function f() public pure { uint x; }
+				function g() public { (1); }
+			}
+		)";
+	BOOST_CHECK(!checkConcurrentAnalysis(sources).empty());
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_type_checking)
+{
+	map<string, string> sources;
+	for (size_t i = 0; i < 8; ++i)
+		sources["s" + to_string(i)] = R"(
+			import "s0";
+			contract A)" + to_string(i) + R"( {
+				function f() public { new B)" + to_string(i) + R"((); uint x = "a"; }
+			}
+			contract B)" + to_string(i) + R"( {
+				function f() public { new A)" + to_string(i) + R"((); bool b = 1; }
+				function g() public returns (bytes memory) { return type(B)" + to_string(i) + R"().creationCode; }
+			}
+		)";
+	BOOST_CHECK(checkConcurrentAnalysis(sources).size() > 8);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_type_queries)
+{
+	CompilerStack c;
+	c.setSources({{"a", R"(
+		contract C {
+			struct S { uint a; S[] s; }
+			uint x;
+			function f(uint[] memory) public {}
+			function g(S storage) internal {}
+		}
+	)"}});
+	c.setEVMVersion(dev::test::Options::get().evmVersion());
+	BOOST_REQUIRE(c.parseAndAnalyze());
+	ContractDefinition const& contract = dynamic_cast<ContractDefinition const&>(*c.ast("a").nodes().back());
+	StructDefinition const& structDefinition = *contract.definedStructs().front();
+
+	// All threads query the lazily computed properties of the same fresh types at the same
+	// time. Each property has to be computed once, so every thread has to get the same object.
+	unsigned constexpr threads = 8;
+	for (unsigned round = 0; round < 20; ++round)
+	{
+		Type const* contractType = TypeProvider::contract(contract);
+		Type const* structType = TypeProvider::structType(structDefinition, DataLocation::Storage);
+		vector<vector<void const*>> results(threads);
+		atomic<unsigned> waiting{threads};
+		parallelFor(threads, threads, [&](size_t _index, unsigned)
+		{
+			--waiting;
+			while (waiting > 0)
+				this_thread::yield();
+			results[_index] = {
+				&contractType->members(&contract),
+				&contractType->richIdentifier(),
+				&contractType->identifier(),
+				&structType->members(nullptr),
+				&structType->richIdentifier(),
+				structType->interfaceType(false).get(),
+				structType->interfaceType(true).get()
+			};
+		});
+		for (auto const& result: results)
+			BOOST_REQUIRE(result == results.front());
+		BOOST_CHECK(!results.front()[5]);
+		BOOST_CHECK(dynamic_cast<StructType const&>(*structType).recursive());
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
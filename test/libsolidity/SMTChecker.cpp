@@ -19,9 +19,11 @@
  */
 
 #include <test/libsolidity/AnalysisFramework.h>
+#include <test/Options.h>
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
 #include <string>
 
 using namespace std;
@@ -52,6 +54,21 @@ protected:
 			_allowMultipleErrors
 		);
 	}
+
+	/// @returns the formatted messages of analysing @a _source with the SMT checker
+	/// verifying on @a _jobs threads.
+	std::vector<std::string> analyzeWithJobs(std::string const& _source, unsigned _jobs)
+	{
+		compiler().reset();
+		compiler().setSources({{"", "pragma solidity >=0.0;\n" + _source}});
+		compiler().setEVMVersion(dev::test::Options::get().evmVersion());
+		compiler().setSMTCheckerJobs(_jobs);
+		BOOST_REQUIRE(compiler().parseAndAnalyze());
+		std::vector<std::string> messages;
+		for (auto const& error: compiler().errors())
+			messages.push_back(formatError(*error));
+		return messages;
+	}
 };
 
 BOOST_FIXTURE_TEST_SUITE(SMTChecker, SMTCheckerFramework)
@@ -246,6 +263,88 @@ BOOST_AUTO_TEST_CASE(mod)
 	CHECK_SUCCESS_NO_WARNINGS(text);
 }
 
+BOOST_AUTO_TEST_CASE(concurrent_verification)
+{
+	string text = R"(
+		pragma experimental SMTChecker;
+		contract B {
+			uint x;
+			function g(uint a) public { x = a + 1; }
+		}
+		contract C is B {
+			function f(uint a, uint b) public pure returns (uint) {
+				require(b < 10);
+				return a / b;
+			}
+			function h(uint a) public pure {
+				assert(a > 2);
+			}
+			function i(uint a) public pure {
+				if (a > 2 || a <= 2) {}
+			}
+			function j(uint a) public {
+				x = a;
+				assert(x == a);
+				g(a);
+				assert(x == a);
+			}
+		}
+	)";
+	vector<string> sequential = analyzeWithJobs(text, 1);
+	BOOST_CHECK(sequential.size() > 4);
+	BOOST_CHECK(analyzeWithJobs(text, 4) == sequential);
+	BOOST_CHECK(analyzeWithJobs(text, 0) == sequential);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_verification_base_state_variables)
+{
+	// Same as smtCheckerTests/inheritance/base_state_var_assignment*.sol.
+	string text = R"(
+		pragma experimental SMTChecker;
+		contract A {
+			uint x;
+		}
+		contract B is A {
+			function f(uint a) public {
+				x = a;
+				assert(x == a);
+			}
+			function g(uint a) public {
+				x = a;
+				assert(x != a);
+			}
+		}
+	)";
+	vector<string> sequential = analyzeWithJobs(text, 1);
+	BOOST_CHECK_EQUAL(count_if(sequential.begin(), sequential.end(), [](string const& _message) {
+		return _message.find("Assertion violation") != string::npos;
+	}), 1);
+	BOOST_CHECK(analyzeWithJobs(text, 4) == sequential);
+}
+
+BOOST_AUTO_TEST_CASE(concurrent_verification_unsupported_base_state_variables)
+{
+	// Same as smtCheckerTests/inheritance/base_unsupported_state_var.sol.
+	string text = R"(
+		pragma experimental SMTChecker;
+		contract A {
+			struct S { uint a; }
+			S s;
+		}
+		contract B is A {
+			function f(uint a) public pure returns (uint) { return a; }
+			function g(uint a) public pure returns (uint) { return a; }
+			function h(uint a) public pure returns (uint) { return a; }
+		}
+	)";
+	vector<string> sequential = analyzeWithJobs(text, 1);
+	// Reported once for A and not again for B or for every member verified on its own.
+	BOOST_CHECK_EQUAL(count_if(sequential.begin(), sequential.end(), [](string const& _message) {
+		return _message.find("does not yet support the type of this variable") != string::npos;
+	}), 1);
+	BOOST_CHECK(analyzeWithJobs(text, 4) == sequential);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -19,9 +19,18 @@
  */
 
 #include <test/libsolidity/AnalysisFramework.h>
+#include <test/tools/yulInterpreter/EVMInstructionInterpreter.h>
+#include <test/tools/yulInterpreter/Interpreter.h>
 #include <test/Metadata.h>
 #include <test/Options.h>
 
+#include <libsolidity/ast/AST.h>
+#include <libsolidity/codegen/Compiler.h>
+#include <libsolidity/codegen/CompilerContext.h>
+#include <libsolidity/codegen/MultiUseYulFunctionCollector.h>
+
+#include <libevmasm/Instruction.h>
+
 using namespace std;
 
 namespace dev
@@ -31,6 +40,135 @@ namespace solidity
 namespace test
 {
 
+namespace
+{
+
+/// Compiles all contracts of the source @a _name of the analysed @a _stack in order of
+/// definition, each with a new compiler using @a _yulFunctionCache, and @returns their
+/// creation bytecode by contract name.
+map<string, bytes> compileContracts(
+	CompilerStack const& _stack,
+	string const& _name,
+	OptimiserSettings const& _optimiserSettings,
+	shared_ptr<MultiUseYulFunctionCache> const& _yulFunctionCache
+)
+{
+	map<string, bytes> bytecode;
+	map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
+	for (auto const& node: _stack.ast(_name).nodes())
+		if (auto contract = dynamic_cast<ContractDefinition const*>(node.get()))
+		{
+			auto compiler = make_shared<Compiler>(
+				dev::test::Options::get().evmVersion(),
+				_optimiserSettings,
+				_yulFunctionCache
+			);
+			compiler->compileContract(*contract, otherCompilers, bytes());
+			otherCompilers[contract] = compiler;
+			bytecode[contract->name()] = compiler->assembledObject().bytecode;
+		}
+	return bytecode;
+}
+
+/// @returns the bytecode of @a _snippet appended as inline assembly to a new compiler context
+/// using @a _cache, after pushing one value for each of @a _localVariables.
+bytes assembleSnippet(
+	shared_ptr<InlineAssemblyCache> const& _cache,
+	string const& _snippet,
+	vector<string> const& _localVariables,
+	langutil::EVMVersion _evmVersion,
+	OptimiserSettings const& _optimiserSettings
+)
+{
+	CompilerContext context(_evmVersion, nullptr, nullptr, _cache);
+	for (size_t i = 0; i < _localVariables.size(); ++i)
+		context << u256(i + 1);
+	context.appendInlineAssembly(_snippet, _localVariables, {}, false, _optimiserSettings);
+	return context.assembledObject().bytecode;
+}
+
+/// Executes the runtime code @a _code on @a _state, using the instruction semantics of the
+/// Yul interpreter. Calls to other contracts are not supported.
+/// @returns false if the execution reverted or failed.
+bool execute(bytes const& _code, yul::test::InterpreterState& _state)
+{
+	using namespace dev::eth;
+	yul::test::EVMInstructionInterpreter interpreter(_state);
+	vector<u256> stack;
+	auto pop = [&]()
+	{
+		BOOST_REQUIRE(!stack.empty());
+		u256 value = stack.back();
+		stack.pop_back();
+		return value;
+	};
+	auto jumpTo = [&](u256 const& _target)
+	{
+		BOOST_REQUIRE(_target < _code.size() && Instruction(_code[size_t(_target)]) == Instruction::JUMPDEST);
+		return size_t(_target);
+	};
+	for (size_t pc = 0; pc < _code.size();)
+	{
+		Instruction instruction = Instruction(_code[pc]);
+		if (isPushInstruction(instruction))
+		{
+			u256 value;
+			for (size_t i = 1; i <= getPushNumber(instruction); ++i)
+				value = (value << 8) + (pc + i < _code.size() ? _code[pc + i] : 0);
+			stack.push_back(value);
+			pc += 1 + getPushNumber(instruction);
+			continue;
+		}
+		else if (isDupInstruction(instruction))
+		{
+			BOOST_REQUIRE(stack.size() >= getDupNumber(instruction));
+			stack.push_back(stack[stack.size() - getDupNumber(instruction)]);
+		}
+		else if (isSwapInstruction(instruction))
+		{
+			BOOST_REQUIRE(stack.size() > getSwapNumber(instruction));
+			swap(stack.back(), stack[stack.size() - 1 - getSwapNumber(instruction)]);
+		}
+		else if (instruction == Instruction::JUMP)
+		{
+			pc = jumpTo(pop());
+			continue;
+		}
+		else if (instruction == Instruction::JUMPI)
+		{
+			u256 target = pop();
+			if (pop() != 0)
+			{
+				pc = jumpTo(target);
+				continue;
+			}
+		}
+		else if (instruction == Instruction::POP)
+			pop();
+		else if (instruction != Instruction::JUMPDEST)
+		{
+			InstructionInfo info = instructionInfo(instruction);
+			vector<u256> arguments;
+			for (int i = 0; i < info.args; ++i)
+				arguments.push_back(pop());
+			try
+			{
+				u256 result = interpreter.eval(instruction, arguments);
+				if (info.ret)
+					stack.push_back(result);
+			}
+			catch (yul::test::ExplicitlyTerminated const&)
+			{
+				return instruction == Instruction::STOP || instruction == Instruction::RETURN;
+			}
+		}
+		++pc;
+	}
+	return true;
+}
+
+}
+
 BOOST_FIXTURE_TEST_SUITE(SolidityCompiler, AnalysisFramework)
 
 BOOST_AUTO_TEST_CASE(does_not_include_creation_time_only_internal_functions)
@@ -53,6 +191,191 @@ BOOST_AUTO_TEST_CASE(does_not_include_creation_time_only_internal_functions)
 	BOOST_CHECK(runtimeBytecode.size() <= 30);
 }
 
+BOOST_AUTO_TEST_CASE(shared_yul_functions)
+{
+	// B and C reuse the encoding and decoding functions of S generated for A, B through a
+	// function that is new to it and C directly. Both need the dependencies of the shared
+	// functions, e.g. the encoding and decoding of the members.
+	char const* sourceCode = R"(
+		pragma experimental ABIEncoderV2;
+		contract A {
+			struct S { uint a; bytes b; uint16[] c; }
+			function f(S memory s) public pure returns (bytes memory) { return abi.encode(s); }
+		}
+		contract B {
+			function g(A.S[] memory s) public pure returns (bytes memory) { return abi.encode(s); }
+		}
+		contract C {
+			function h(bytes memory data) public pure returns (A.S memory) { return abi.decode(data, (A.S)); }
+			function i(A.S memory s) public pure returns (A.S memory) { return s; }
+		}
+	)";
+	CompilerStack stack;
+	stack.setSources({{"", sourceCode}});
+	stack.setEVMVersion(dev::test::Options::get().evmVersion());
+	BOOST_REQUIRE(stack.parseAndAnalyze());
+
+	for (auto const& optimiserSettings: {OptimiserSettings::minimal(), OptimiserSettings::full()})
+	{
+		map<string, bytes> separate = compileContracts(stack, "", optimiserSettings, nullptr);
+		map<string, bytes> shared = compileContracts(
+			stack,
+			"",
+			optimiserSettings,
+			make_shared<MultiUseYulFunctionCache>()
+		);
+		BOOST_REQUIRE_EQUAL(separate.size(), 3);
+		BOOST_CHECK(separate == shared);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(inline_assembly_cache_hits)
+{
+	auto cache = make_shared<InlineAssemblyCache>();
+	langutil::EVMVersion evmVersion = dev::test::Options::get().evmVersion();
+	string const first = "{ mstore(0, 1) }";
+	string const second = "{ mstore(0, 2) }";
+	bytes const firstCode = assembleSnippet(nullptr, first, {}, evmVersion, OptimiserSettings::none());
+	BOOST_CHECK(firstCode != assembleSnippet(nullptr, second, {}, evmVersion, OptimiserSettings::none()));
+
+	BOOST_CHECK(assembleSnippet(cache, first, {}, evmVersion, OptimiserSettings::none()) == firstCode);
+	InlineAssemblyCache::Key firstKey{first, {}, {}, evmVersion.name(), false, false};
+	auto entry = cache->find(firstKey);
+	BOOST_REQUIRE(entry);
+	BOOST_CHECK(assembleSnippet(cache, first, {}, evmVersion, OptimiserSettings::none()) == firstCode);
+	BOOST_CHECK(cache->find(firstKey) == entry);
+
+	// A cached entry is used without parsing the snippet again.
+	cache->store(InlineAssemblyCache::Key{second, {}, {}, evmVersion.name(), false, false}, entry);
+	BOOST_CHECK(assembleSnippet(cache, second, {}, evmVersion, OptimiserSettings::none()) == firstCode);
+}
+
+BOOST_AUTO_TEST_CASE(inline_assembly_cache_keys)
+{
+	auto cache = make_shared<InlineAssemblyCache>();
+	langutil::EVMVersion evmVersion = dev::test::Options::get().evmVersion();
+	auto check = [&](string const& _snippet, vector<string> const& _localVariables, langutil::EVMVersion _evmVersion, OptimiserSettings const& _settings)
+	{
+		bytes uncached = assembleSnippet(nullptr, _snippet, _localVariables, _evmVersion, _settings);
+		BOOST_CHECK(assembleSnippet(cache, _snippet, _localVariables, _evmVersion, _settings) == uncached);
+		return uncached;
+	};
+
+	// Only blocks without local variables are optimized.
+	string const functions = R"({
+		function f(a, b) -> c { let x := add(a, b) let y := mul(x, 2) c := sub(y, a) }
+		mstore(0, f(calldataload(0), calldataload(32)))
+	})";
+	OptimiserSettings withoutStackAllocation = OptimiserSettings::full();
+	withoutStackAllocation.optimizeStackAllocation = false;
+	bytes optimized = check(functions, {}, evmVersion, OptimiserSettings::full());
+	bytes unoptimized = check(functions, {}, evmVersion, OptimiserSettings::minimal());
+	BOOST_CHECK(optimized != unoptimized);
+	check(functions, {}, evmVersion, withoutStackAllocation);
+	BOOST_CHECK(check(functions, {}, evmVersion, OptimiserSettings::full()) == optimized);
+	auto optimizedEntry = cache->find({functions, {}, {}, evmVersion.name(), true, true});
+	auto withoutStackAllocationEntry = cache->find({functions, {}, {}, evmVersion.name(), true, false});
+	BOOST_REQUIRE(optimizedEntry && withoutStackAllocationEntry);
+	BOOST_CHECK(optimizedEntry != withoutStackAllocationEntry);
+	BOOST_CHECK(cache->find({functions, {}, {}, evmVersion.name(), false, false}));
+
+	// Stack slots of unused variables are only reused with stack allocation optimization.
+	string const variables = R"({
+		let a := calldataload(0)
+		mstore(0, a)
+		let b := calldataload(32)
+		mstore(32, b)
+	})";
+	OptimiserSettings withStackAllocation = OptimiserSettings::minimal();
+	withStackAllocation.optimizeStackAllocation = true;
+	BOOST_CHECK(
+		check(variables, {}, evmVersion, withStackAllocation) !=
+		check(variables, {}, evmVersion, OptimiserSettings::minimal())
+	);
+
+	// The local variables determine the stack layout and how identifiers resolve.
+	string const assignment = "{ x := add(x, 1) }";
+	bytes shallow = check(assignment, {"x"}, evmVersion, OptimiserSettings::none());
+	bytes deep = check(assignment, {"x", "y"}, evmVersion, OptimiserSettings::none());
+	BOOST_CHECK(shallow != deep);
+	auto shallowEntry = cache->find({assignment, {"x"}, {}, evmVersion.name(), false, false});
+	auto deepEntry = cache->find({assignment, {"x", "y"}, {}, evmVersion.name(), false, false});
+	BOOST_REQUIRE(shallowEntry && deepEntry);
+	BOOST_CHECK(shallowEntry != deepEntry);
+	// Not resolvable without x, which must not be hidden by the entries above.
+	BOOST_CHECK_THROW(
+		assembleSnippet(cache, assignment, {"y"}, evmVersion, OptimiserSettings::none()),
+		langutil::InternalCompilerError
+	);
+	BOOST_CHECK(!cache->find({assignment, {"y"}, {}, evmVersion.name(), false, false}));
+
+	// Instructions only available in later EVM versions are rejected for earlier versions.
+	string const returndata = "{ mstore(0, returndatasize()) }";
+	check(returndata, {}, langutil::EVMVersion::byzantium(), OptimiserSettings::none());
+	BOOST_CHECK_THROW(
+		assembleSnippet(cache, returndata, {}, langutil::EVMVersion::homestead(), OptimiserSettings::none()),
+		langutil::InternalCompilerError
+	);
+}
+
+BOOST_AUTO_TEST_CASE(shrinking_packed_storage_array_clears_slots)
+{
+	char const* sourceCode = R"(
+		contract C {
+			uint8[] x;
+			uint8[] y;
+			uint16[] z;
+			function fill() public {
+				for (uint i = 0; i < 64; i++)
+					x.push(uint8(i + 1));
+				for (uint i = 0; i < 32; i++)
+					z.push(uint16(i + 1));
+				y.push(7);
+			}
+			function copySameType() public { x = y; }
+			function copyConverted() public { z = y; }
+			function copyFromMemory() public { x = new uint8[](1); }
+		}
+	)";
+	for (auto const& settings: {OptimiserSettings::minimal(), OptimiserSettings::standard()})
+	{
+		compiler().reset();
+		compiler().setSources({{"", "pragma solidity >=0.0;\n" + string(sourceCode)}});
+		compiler().setEVMVersion(dev::test::Options::get().evmVersion());
+		compiler().setOptimiserSettings(settings);
+		BOOST_REQUIRE_MESSAGE(compiler().compile(), "Compiling contract failed");
+		bytes const& code = compiler().runtimeObject("C").bytecode;
+
+		// The slots of the data of x, y and z, in declaration order.
+		vector<u256> data;
+		for (unsigned i = 0; i < 3; ++i)
+			data.push_back(u256(keccak256(h256(i))));
+		// The second data slot of the target, which only holds elements that are removed by the copy.
+		for (auto const& copy: vector<pair<string, u256>>{
+			{"copySameType()", data[0] + 1},
+			{"copyConverted()", data[2] + 1},
+			{"copyFromMemory()", data[0] + 1}
+		})
+		{
+			string const& function = copy.first;
+			h256 const freedSlot(copy.second);
+			yul::test::InterpreterState state;
+			state.callvalue = 0;
+			state.maxMemSize = 0x10000;
+			for (string const& call: {string("fill()"), function})
+			{
+				state.calldata = keccak256(call).ref().cropped(0, 4).toBytes();
+				BOOST_REQUIRE_MESSAGE(execute(code, state), "Calling " + call + " failed");
+			}
+			BOOST_REQUIRE(state.storage.count(freedSlot));
+			BOOST_CHECK_MESSAGE(
+				!state.storage.at(freedSlot),
+				"Slot not cleared by " + function + ": " + state.storage.at(freedSlot).hex()
+			);
+		}
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
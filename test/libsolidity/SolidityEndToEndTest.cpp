@@ -3627,6 +3627,26 @@ BOOST_AUTO_TEST_CASE(short_data_calls_fallback)
 	ABI_CHECK(callContractFunction("x()"), encodeArgs(3));
 }
 
+BOOST_AUTO_TEST_CASE(jump_table_function_selector)
+{
+	// enough functions and expected executions for the selector to use a jump table
+	string sourceCode = "contract C {\n\tuint public x;\n";
+	for (size_t i = 0; i < 300; ++i)
+		sourceCode += "\tfunction f" + to_string(i) + "() public pure returns (uint) { return " + to_string(i) + "; }\n";
+	sourceCode += "\tfunction () external { x = 7; }\n}\n";
+	for (bool optimize: {false, true})
+	{
+		m_optimiserSettings = optimize ? OptimiserSettings::standard() : OptimiserSettings::minimal();
+		m_optimiserSettings.expectedExecutionsPerDeployment = 1000000;
+		compileAndRun(sourceCode);
+		for (size_t i: {0, 1, 17, 150, 298, 299})
+			ABI_CHECK(callContractFunction("f" + to_string(i) + "()"), encodeArgs(i));
+		ABI_CHECK(callContractFunction("x()"), encodeArgs(0));
+		ABI_CHECK(callContractFunction("f300()"), encodeArgs());
+		ABI_CHECK(callContractFunction("x()"), encodeArgs(7));
+	}
+}
+
 BOOST_AUTO_TEST_CASE(event)
 {
 	char const* sourceCode = R"(
@@ -5643,6 +5663,61 @@ BOOST_AUTO_TEST_CASE(array_copy_target_leftover2)
 	));
 }
 
+BOOST_AUTO_TEST_CASE(array_copy_memory_calldata_packed_storage)
+{
+	// values are combined into full slots, the remaining slots of the target are cleared as a whole
+	char const* sourceCode = R"(
+		contract c {
+			uint8[] data;
+			int16[] signedData;
+			function fromMemory() public returns (uint8[] memory, int16[] memory) {
+				uint8[] memory x = new uint8[](70);
+				for (uint i = 0; i < x.length; ++i)
+					x[i] = uint8(i + 1);
+				data = x;
+				int16[] memory y = new int16[](3);
+				y[0] = -1;
+				y[1] = 2;
+				y[2] = -3;
+				signedData = y;
+				return (data, signedData);
+			}
+			function fromCalldata(int16[] calldata y) external returns (int16[] memory) {
+				signedData = y;
+				return signedData;
+			}
+			function shrink() public returns (uint8[] memory) {
+				uint8[] memory x = new uint8[](3);
+				x[0] = 7;
+				x[1] = 8;
+				x[2] = 9;
+				data = x;
+				data.length = 40;
+				return data;
+			}
+		}
+	)";
+	compileAndRun(sourceCode);
+	bytes sequence;
+	for (size_t i = 1; i <= 70; ++i)
+		sequence += toBigEndian(u256(i));
+	ABI_CHECK(
+		callContractFunction("fromMemory()"),
+		encodeArgs(0x40, 0x40 + 71 * 32, 70) + sequence + encodeArgs(3, u256(-1), 2, u256(-3))
+	);
+	bytes signedSequence;
+	for (size_t i = 0; i < 17; ++i)
+		signedSequence += toBigEndian(u256(i % 2 ? -int(i) : int(i)));
+	ABI_CHECK(
+		callContractFunction("fromCalldata(int16[])", 0x20, 17, signedSequence),
+		encodeArgs(0x20, 17) + signedSequence
+	);
+	ABI_CHECK(
+		callContractFunction("shrink()"),
+		encodeArgs(0x20, 40, 7, 8, 9) + bytes(37 * 32, 0)
+	);
+}
+
 BOOST_AUTO_TEST_CASE(array_copy_storage_storage_struct)
 {
 	char const* sourceCode = R"(
@@ -28,8 +28,6 @@
 
 #include <libsolidity/interface/CompilerStack.h>
 
-#include <libyul/AssemblyStack.h>
-
 #include <liblangutil/Exceptions.h>
 #include <liblangutil/SourceReferenceFormatter.h>
 
@@ -77,7 +75,7 @@ public:
 		m_compiler.setLibraries(_libraryAddresses);
 		m_compiler.setEVMVersion(m_evmVersion);
 		m_compiler.setOptimiserSettings(m_optimiserSettings);
-		m_compiler.enableIRGeneration(m_compileViaYul);
+		m_compiler.enableCodeGenerationViaIR(m_compileViaYul);
 		if (!m_compiler.compile())
 		{
 			langutil::SourceReferenceFormatter formatter(std::cerr);
@@ -86,29 +84,7 @@ public:
 				formatter.printErrorInformation(*error);
 			BOOST_ERROR("Compiling contract failed");
 		}
-		eth::LinkerObject obj;
-		if (m_compileViaYul)
-		{
-			yul::AssemblyStack asmStack(
-				m_evmVersion,
-				yul::AssemblyStack::Language::StrictAssembly,
-				m_optimiserSettings
-			);
-			if (!asmStack.parseAndAnalyze("", m_compiler.yulIROptimized(
-				_contractName.empty() ? m_compiler.lastContractName() : _contractName
-			)))
-			{
-				langutil::SourceReferenceFormatter formatter(std::cerr);
-
-				for (auto const& error: m_compiler.errors())
-					formatter.printErrorInformation(*error);
-				BOOST_ERROR("Assembly contract failed. IR: " + m_compiler.yulIROptimized({}));
-			}
-			asmStack.optimize();
-			obj = std::move(*asmStack.assemble(yul::AssemblyStack::Machine::EVM).bytecode);
-		}
-		else
-			obj = m_compiler.object(_contractName.empty() ? m_compiler.lastContractName() : _contractName);
+		eth::LinkerObject obj = m_compiler.object(_contractName.empty() ? m_compiler.lastContractName() : _contractName);
 		BOOST_REQUIRE(obj.linkReferences.empty());
 		return obj.bytecode;
 	}
@@ -220,6 +220,20 @@ BOOST_AUTO_TEST_CASE(type_identifiers)
 	BOOST_CHECK_EQUAL(InaccessibleDynamicType().identifier(), "t_inaccessible");
 }
 
+BOOST_AUTO_TEST_CASE(type_identifier_hash)
+{
+	TypePointer uintArray = TypeProvider::array(DataLocation::Memory, TypeProvider::uint256());
+	TypePointer otherUintArray = TypeProvider::array(DataLocation::Memory, TypeProvider::uint256());
+	TypePointer intArray = TypeProvider::array(DataLocation::Memory, TypeProvider::fromElementaryTypeName("int256"));
+	BOOST_REQUIRE(uintArray != otherUintArray);
+	BOOST_CHECK(*uintArray == *otherUintArray);
+	BOOST_CHECK_EQUAL(uintArray->identifierHash(), otherUintArray->identifierHash());
+	BOOST_CHECK(uintArray->identifierHash() != intArray->identifierHash());
+	// The identifier is computed only once.
+	BOOST_CHECK_EQUAL(&uintArray->identifier(), &uintArray->identifier());
+	BOOST_CHECK_EQUAL(uintArray->identifier(), "t_array$_t_uint256_$dyn_memory_ptr");
+}
+
 BOOST_AUTO_TEST_CASE(encoded_sizes)
 {
 	BOOST_CHECK_EQUAL(IntegerType(16).calldataEncodedSize(true), 32);
@@ -266,7 +280,7 @@ BOOST_AUTO_TEST_CASE(helper_bool_result)
 
 	BoolResult r7{true};
 	// Attention: this will implicitly convert to bool.
-	BoolResult r8{"true"};
+	BoolResult r8{static_cast<bool>("true")};
 	r7.merge(r8, logical_and<bool>());
 	BOOST_REQUIRE_EQUAL(r7.get(), true);
 	BOOST_REQUIRE_EQUAL(r7.message(), "");
@@ -22,6 +22,9 @@
 #include <string>
 #include <boost/test/unit_test.hpp>
 #include <libsolidity/interface/StandardCompiler.h>
+#include <libsolidity/interface/CompilerStack.h>
+#include <libsolidity/ast/ASTBinaryConverter.h>
+#include <libdevcore/CommonData.h>
 #include <libdevcore/JSON.h>
 #include <test/Metadata.h>
 
@@ -387,6 +390,67 @@ BOOST_AUTO_TEST_CASE(basic_compilation)
 	);
 }
 
+BOOST_AUTO_TEST_CASE(binary_ast)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"fileA": {
+				"content": "contract A { function f(uint a) public pure returns (uint) { return a + 1; } }"
+			}
+		},
+		"settings": {
+			"outputSelection": {
+				"fileA": {
+					"": [ "ast", "astBinary" ]
+				}
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	Json::Value const& source = result["sources"]["fileA"];
+	BOOST_REQUIRE(source["ast"].isObject());
+	BOOST_REQUIRE(source["astBinary"].isString());
+	bytes binary = fromHex(source["astBinary"].asString());
+	BOOST_CHECK_EQUAL(
+		dev::jsonCompactPrint(ASTBinaryConverter::decode(binary)),
+		dev::jsonCompactPrint(source["ast"])
+	);
+	BOOST_CHECK_LT(binary.size(), dev::jsonCompactPrint(source["ast"]).size());
+	binary.pop_back();
+	BOOST_CHECK_THROW(ASTBinaryConverter::decode(binary), InvalidBinaryAST);
+}
+
+BOOST_AUTO_TEST_CASE(ast_binary_not_matched_by_wildcard)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"fileA": {
+				"content": "contract A { }"
+			}
+		},
+		"settings": {
+			"outputSelection": {
+				"*": {
+					"": [ "*" ]
+				}
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	Json::Value const& source = result["sources"]["fileA"];
+	BOOST_CHECK(source["ast"].isObject());
+	BOOST_CHECK(source["legacyAST"].isObject());
+	BOOST_CHECK(!source.isMember("astBinary"));
+}
+
 BOOST_AUTO_TEST_CASE(compilation_error)
 {
 	char const* input = R"(
@@ -862,6 +926,109 @@ BOOST_AUTO_TEST_CASE(evm_version)
 	BOOST_CHECK(result["errors"][0]["message"].asString() == "Invalid EVM version requested.");
 }
 
+BOOST_AUTO_TEST_CASE(via_ir)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"viaIR": true,
+			"outputSelection": {
+				"fileA": { "A": [ "metadata", "evm.bytecode.object", "evm.bytecode.sourceMap", "evm.deployedBytecode.object", "evm.deployedBytecode.sourceMap" ] }
+			}
+		},
+		"sources": {
+			"fileA": {
+				"content": "contract A { function f(uint a) public pure returns (uint x) { x = a; } }"
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	Json::Value contract = getContractResult(result, "fileA", "A");
+	BOOST_REQUIRE(contract.isObject());
+	BOOST_REQUIRE(contract["evm"]["bytecode"]["object"].isString());
+	BOOST_REQUIRE(contract["evm"]["deployedBytecode"]["object"].isString());
+	string deployedBytecode = contract["evm"]["deployedBytecode"]["object"].asString();
+	BOOST_CHECK(!deployedBytecode.empty());
+	// the creation code contains the runtime code
+	BOOST_CHECK(contract["evm"]["bytecode"]["object"].asString().find(deployedBytecode) != string::npos);
+	// Source locations are not yet carried through the IR, so all locations are empty.
+	for (auto const& sourceMap: {
+		contract["evm"]["bytecode"]["sourceMap"],
+		contract["evm"]["deployedBytecode"]["sourceMap"]
+	})
+	{
+		BOOST_REQUIRE(sourceMap.isString());
+		BOOST_CHECK(!sourceMap.asString().empty());
+		BOOST_CHECK_EQUAL(sourceMap.asString().find_first_of("0123456789"), string::npos);
+	}
+	BOOST_CHECK(contract["metadata"].asString().find("\"viaIR\":true") != string::npos);
+
+	result = compile(R"(
+	{
+		"language": "Solidity",
+		"settings": { "viaIR": 1 },
+		"sources": { "fileA": { "content": "contract A { }" } }
+	}
+	)");
+	BOOST_CHECK(containsError(result, "JSONError", "\"settings.viaIR\" must be a Boolean."));
+}
+
+BOOST_AUTO_TEST_CASE(ir_optimized_on_request)
+{
+	auto compileWith = [&](string const& _outputs)
+	{
+		Json::Value result = compile(R"(
+		{
+			"language": "Solidity",
+			"settings": {
+				"optimizer": { "enabled": true, "details": { "yul": true } },
+				"outputSelection": {
+					"fileA": { "A": [ )" + _outputs + R"( ] }
+				}
+			},
+			"sources": {
+				"fileA": {
+					"content": "contract A { function f(uint a) public pure returns (uint x) { x = a; } }"
+				}
+			}
+		}
+		)");
+		BOOST_CHECK(containsAtMostWarnings(result));
+		Json::Value contract = getContractResult(result, "fileA", "A");
+		BOOST_REQUIRE(contract.isObject());
+		return contract;
+	};
+
+	Json::Value contract = compileWith("\"ir\"");
+	BOOST_CHECK(contract["ir"].isString());
+	BOOST_CHECK(!contract.isMember("irOptimized"));
+	string const ir = contract["ir"].asString();
+
+	contract = compileWith("\"irOptimized\"");
+	BOOST_CHECK(!contract.isMember("ir"));
+	BOOST_REQUIRE(contract["irOptimized"].isString());
+	string const optimized = contract["irOptimized"].asString();
+	BOOST_CHECK(optimized != ir);
+
+	contract = compileWith("\"ir\", \"irOptimized\"");
+	BOOST_CHECK_EQUAL(contract["ir"].asString(), ir);
+	BOOST_CHECK_EQUAL(contract["irOptimized"].asString(), optimized);
+
+	// The optimized IR is computed on the first request and cached afterwards.
+	CompilerStack stack;
+	stack.setSources({{"fileA", "contract A { function f(uint a) public pure returns (uint x) { x = a; } }"}});
+	stack.setOptimiserSettings(OptimiserSettings::full());
+	stack.enableIRGeneration();
+	BOOST_REQUIRE(stack.compile());
+	BOOST_CHECK_EQUAL(stack.yulIR("fileA:A"), ir);
+	string const& cached = stack.yulIROptimized("fileA:A");
+	BOOST_CHECK_EQUAL(cached, optimized);
+	BOOST_CHECK_EQUAL(&stack.yulIROptimized("fileA:A"), &cached);
+}
+
 BOOST_AUTO_TEST_CASE(optimizer_settings_default_disabled)
 {
 	char const* input = R"(
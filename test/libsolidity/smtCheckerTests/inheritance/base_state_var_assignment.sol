@@ -0,0 +1,14 @@
+pragma experimental SMTChecker;
+
+contract A
+{
+	uint x;
+}
+
+contract B is A
+{
+	function f(uint a) public {
+		x = a;
+		assert(x == a);
+	}
+}
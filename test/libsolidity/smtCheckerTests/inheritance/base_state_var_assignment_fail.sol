@@ -0,0 +1,17 @@
+pragma experimental SMTChecker;
+
+contract A
+{
+	uint x;
+}
+
+contract B is A
+{
+	function f(uint a) public {
+		x = a;
+		// Should fail for every `a`.
+		assert(x != a);
+	}
+}
+// ----
+// Warning: (148-162): Assertion violation happens here
@@ -0,0 +1,16 @@
+pragma experimental SMTChecker;
+
+contract A
+{
+	struct S { uint a; }
+	S s;
+}
+
+contract B is A
+{
+	function f(uint a) public pure returns (uint) { return a; }
+	function g(uint a) public pure returns (uint) { return a; }
+	function h(uint a) public pure returns (uint) { return a; }
+}
+// ----
+// Warning: (69-72): Assertion checker does not yet support the type of this variable.
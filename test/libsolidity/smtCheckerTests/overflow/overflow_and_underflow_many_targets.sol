@@ -0,0 +1,18 @@
+pragma experimental SMTChecker;
+
+contract C
+{
+	function f(uint8 x, uint8 y) public pure returns (uint8) {
+		require(x < 100 && y < 100);
+		uint8 a = x + y;
+		uint8 b = x * 2;
+		uint8 c = a - b;
+		uint8 e = y * 3;
+		require(e != 9);
+		a = a + 1;
+		return c;
+	}
+}
+// ----
+// Warning: (187-192): Underflow (resulting value less than 0) happens here
+// Warning: (206-211): Overflow (resulting value larger than 255) happens here
@@ -0,0 +1,41 @@
+contract c {
+    function f() public pure {
+        bool b;
+        b = 2**61 + (2**61 - 1);
+        b = 2**61 + 2**61;
+        b = -2**61 - 2**61;
+        b = 3**39;
+        b = 3**40;
+        b = (2**31 - 1) * 2**31;
+        b = 2**31 * 2**31;
+        b = 1 << 61;
+        b = 1 << 62;
+        b = -7 % 3;
+        b = -7 >> 1;
+        b = -(2**61) >> 70;
+        b = 6 & 3 | 8 ^ 1;
+        b = 0 << 2**33;
+        b = 0 >> 2**33;
+        b = 1 << 2**32;
+    }
+}
+// ----
+// TypeError: (72-91): Type int_const 4611686018427387903 is not implicitly convertible to expected type bool.
+// TypeError: (105-118): Type int_const 4611686018427387904 is not implicitly convertible to expected type bool.
+// TypeError: (132-146): Type int_const -4611686018427387904 is not implicitly convertible to expected type bool.
+// TypeError: (160-165): Type int_const 4052555153018976267 is not implicitly convertible to expected type bool.
+// TypeError: (179-184): Type int_const 12157665459056928801 is not implicitly convertible to expected type bool.
+// TypeError: (198-217): Type int_const 4611686016279904256 is not implicitly convertible to expected type bool.
+// TypeError: (231-244): Type int_const 4611686018427387904 is not implicitly convertible to expected type bool.
+// TypeError: (258-265): Type int_const 2305843009213693952 is not implicitly convertible to expected type bool.
+// TypeError: (279-286): Type int_const 4611686018427387904 is not implicitly convertible to expected type bool.
+// TypeError: (300-306): Type int_const -1 is not implicitly convertible to expected type bool.
+// TypeError: (320-327): Type int_const -4 is not implicitly convertible to expected type bool.
+// TypeError: (341-355): Type int_const -1 is not implicitly convertible to expected type bool.
+// TypeError: (369-382): Type int_const 11 is not implicitly convertible to expected type bool.
+// TypeError: (396-406): Operator << not compatible with types int_const 0 and int_const 8589934592
+// TypeError: (396-406): Type int_const 0 is not implicitly convertible to expected type bool.
+// TypeError: (420-430): Operator >> not compatible with types int_const 0 and int_const 8589934592
+// TypeError: (420-430): Type int_const 0 is not implicitly convertible to expected type bool.
+// TypeError: (444-454): Operator << not compatible with types int_const 1 and int_const 4294967296
+// TypeError: (444-454): Type int_const 1 is not implicitly convertible to expected type bool.
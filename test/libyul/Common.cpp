@@ -43,7 +43,7 @@ using namespace yul;
 
 namespace
 {
-shared_ptr<Dialect> defaultDialect(bool _yul)
+shared_ptr<Dialect const> defaultDialect(bool _yul)
 {
 	return _yul ? yul::Dialect::yul() : yul::EVMDialect::strictAssemblyForEVM(dev::test::Options::get().evmVersion());
 }
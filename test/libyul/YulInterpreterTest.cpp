@@ -18,6 +18,7 @@
 #include <test/libyul/YulInterpreterTest.h>
 
 #include <test/tools/yulInterpreter/Interpreter.h>
+#include <test/tools/yulInterpreter/CompiledInterpreter.h>
 
 #include <test/Options.h>
 
@@ -132,6 +133,8 @@ string YulInterpreterTest::interpret()
 	state.maxTraceSize = 10000;
 	state.maxSteps = 10000;
 	state.maxMemSize = 0x20000000;
+	InterpreterState compiledState = state;
+
 	Interpreter interpreter(state);
 	try
 	{
@@ -141,15 +144,33 @@ string YulInterpreterTest::interpret()
 	{
 	}
 
+	try
+	{
+		CompiledInterpreter(*m_ast).run(compiledState);
+	}
+	catch (InterpreterTerminatedGeneric const&)
+	{
+	}
+
+	string result = formatState(state);
+	string compiledResult = formatState(compiledState);
+	// Both engines have to behave identically, so report any difference as a test failure.
+	if (compiledResult != result)
+		result += "Compiled interpreter result differs:\n" + compiledResult;
+	return result;
+}
+
+string YulInterpreterTest::formatState(InterpreterState const& _state)
+{
 	stringstream result;
 	result << "Trace:" << endl;;
-	for (auto const& line: interpreter.trace())
+	for (auto const& line: _state.trace)
 		result << "  " << line << endl;
 	result << "Memory dump:\n";
-	for (size_t i = 0; i < state.memory.size(); i += 0x20)
-		result << "  " << std::hex << std::setw(4) << i << ": " << toHex(bytesConstRef(state.memory.data() + i, 0x20).toBytes()) << endl;
+	for (size_t i = 0; i < _state.memory.size(); i += 0x20)
+		result << "  " << std::hex << std::setw(4) << i << ": " << toHex(bytesConstRef(_state.memory.data() + i, 0x20).toBytes()) << endl;
 	result << "Storage dump:" << endl;
-	for (auto const& slot: state.storage)
+	for (auto const& slot: _state.storage)
 		result << "  " << slot.first.hex() << ": " << slot.second.hex() << endl;
 	return result.str();
 }
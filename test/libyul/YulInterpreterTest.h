@@ -38,6 +38,8 @@ namespace yul
 namespace test
 {
 
+struct InterpreterState;
+
 class YulInterpreterTest: public dev::solidity::test::TestCase
 {
 public:
@@ -57,6 +59,8 @@ private:
 	void printIndented(std::ostream& _stream, std::string const& _output, std::string const& _linePrefix = "") const;
 	bool parse(std::ostream& _stream, std::string const& _linePrefix, bool const _formatted);
 	std::string interpret();
+	/// @returns the trace, memory and storage of @a _state in the format of the expectations.
+	static std::string formatState(InterpreterState const& _state);
 
 	static void printErrors(std::ostream& _stream, langutil::ErrorList const& _errors);
 
@@ -59,6 +59,13 @@ IsolTestOptions::IsolTestOptions(std::string* _editor):
 		("editor", po::value<std::string>(_editor)->default_value(editorPath()), "Path to editor for opening test files.")
 		("help", po::bool_switch(&showHelp), "Show this help screen.")
 		("no-color", po::bool_switch(&noColor), "Don't use colors.")
+		(
+			"jobs,j",
+			po::value<unsigned>(&jobs)->default_value(1),
+			"Number of tests to run concurrently in separate processes (0 for the number of hardware threads). "
+			"Results are still reported in order. Tests that use IPC are always run one after the other."
+		)
+		("timings", po::bool_switch(&showTimings), "Show the time needed to run each test.")
 		("test,t", po::value<std::string>(&testFilter)->default_value("*/*"), "Filters which test units to include.");
 }
 
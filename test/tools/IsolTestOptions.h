@@ -32,6 +32,9 @@ struct IsolTestOptions: CommonOptions
 {
 	bool showHelp = false;
 	bool noColor = false;
+	bool showTimings = false;
+	/// Number of tests to run concurrently, zero for the number of hardware threads.
+	unsigned jobs = 1;
 	std::string testFilter = std::string{};
 
 	IsolTestOptions(std::string* _editor);
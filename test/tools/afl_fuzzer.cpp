@@ -22,22 +22,60 @@
 
 #include <libdevcore/CommonIO.h>
 
+#include <boost/filesystem.hpp>
 #include <boost/program_options.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <string>
 #include <iostream>
+#include <utility>
 
 using namespace std;
 using namespace dev;
 
 namespace po = boost::program_options;
 
+namespace
+{
+
+/// Number of inputs AFL runs in persistent mode before the process is restarted.
+unsigned const c_persistentIterations = 1000;
+
+/// @returns true as long as another input should be read from stdin in the same process.
+/// Uses AFL's persistent mode if the binary was built with afl-clang-fast, otherwise
+/// returns true exactly once.
+bool persistentLoop()
+{
+#ifdef __AFL_LOOP
+	return __AFL_LOOP(c_persistentIterations);
+#else
+	static bool first = true;
+	return exchange(first, false);
+#endif
+}
+
+/// @returns the paths of all regular files in @a _directory in lexicographic order.
+vector<string> filesInDirectory(string const& _directory)
+{
+	vector<string> files;
+	for (auto const& entry: boost::filesystem::directory_iterator(_directory))
+		if (boost::filesystem::is_regular_file(entry.status()))
+			files.push_back(entry.path().string());
+	sort(files.begin(), files.end());
+	return files;
+}
+
+}
+
 int main(int argc, char** argv)
 {
 	po::options_description options(
 		R"(solfuzzer, fuzz-testing binary for use with AFL.
 Usage: solfuzzer [Options] < input
 Reads a single source from stdin, compiles it and signals a failure for internal errors.
+With --persistent, keeps reading inputs from stdin in the same process if built for
+AFL's persistent mode. With --input-dir, compiles all files of a directory in the same process.
 
 Allowed options)",
 		po::options_description::m_default_line_length,
@@ -65,6 +103,16 @@ Allowed options)",
 			po::value<std::vector<string>>()->multitoken(),
 			"input files"
 		)
+		(
+			"input-dir",
+			po::value<string>()->value_name("path"),
+			"Process all files in the given directory in a single process."
+		)
+		(
+			"persistent",
+			"Process inputs from stdin in a loop using AFL's persistent mode. "
+			"Only effective if compiled with afl-clang-fast."
+		)
 		(
 			"without-optimizer",
 			"Run without optimizations. Cannot be used together with standard-json."
@@ -102,42 +150,64 @@ Allowed options)",
 		inputs.push_back(arguments["input-file"].as<string>());
 	else if (arguments.count("input-files"))
 		inputs = arguments["input-files"].as<vector<string>>();
-	else
-		inputs.push_back("");
+	else if (arguments.count("input-dir"))
+		inputs = filesInDirectory(arguments["input-dir"].as<string>());
 
 	bool optimize = !arguments.count("without-optimizer");
 	int retResult = 0;
+	size_t executions = 0;
+	auto startTime = chrono::steady_clock::now();
 
-	for (string const& inputFile: inputs)
+	// All compiler state is created per input and global state is reset
+	// when a new compilation starts, so inputs can be run in the same process.
+	auto fuzz = [&](string const& _input)
 	{
-		string input;
-		if (inputFile.size() == 0)
-			input = readStandardInput();
+		executions++;
+		if (arguments.count("const-opt"))
+			FuzzerUtil::testConstantOptimizer(_input, quiet);
+		else if (arguments.count("standard-json"))
+			FuzzerUtil::testStandardCompiler(_input, quiet);
 		else
-			input = readFileAsString(inputFile);
+			FuzzerUtil::testCompiler(_input, optimize, quiet);
+	};
+
+	if (inputs.empty())
+		// Failures have to terminate the process, so that AFL notices them.
+		while (persistentLoop())
+		{
+			// AFL replaces the input and resets stdin between iterations.
+			cin.clear();
+			fuzz(readStandardInput());
+			if (!arguments.count("persistent"))
+				break;
+		}
 
+	for (string const& inputFile: inputs)
+	{
 		try
 		{
-			if (arguments.count("const-opt"))
-				FuzzerUtil::testConstantOptimizer(input, quiet);
-			else if (arguments.count("standard-json"))
-				FuzzerUtil::testStandardCompiler(input, quiet);
-			else
-				FuzzerUtil::testCompiler(input, optimize, quiet);
+			fuzz(readFileAsString(inputFile));
 		}
 		catch (...)
 		{
 			retResult = 1;
 
-			if (inputFile.size() == 0)
-				throw;
-
 			cerr << "Fuzzer "
 				<< (optimize ? "" : "(without optimizer) ")
 				<< "failed on "
-				<< inputFile;
+				<< inputFile
+				<< endl;
 		}
 	}
 
+	if (!quiet && executions > 1)
+	{
+		double seconds = chrono::duration<double>(chrono::steady_clock::now() - startTime).count();
+		cerr << "Executed " << executions << " inputs in " << seconds << " s";
+		if (seconds > 0)
+			cerr << " (" << unsigned(executions / seconds) << " execs/sec)";
+		cerr << "." << endl;
+	}
+
 	return retResult;
 }
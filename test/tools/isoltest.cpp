@@ -17,6 +17,7 @@
 
 #include <libdevcore/CommonIO.h>
 #include <libdevcore/AnsiColorized.h>
+#include <libdevcore/Parallel.h>
 
 #include <test/Common.h>
 #include <test/tools/IsolTestOptions.h>
@@ -28,6 +29,8 @@
 #include <boost/filesystem.hpp>
 #include <boost/program_options.hpp>
 
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
@@ -36,6 +39,10 @@
 
 #if defined(_WIN32)
 #include <windows.h>
+#else
+#include <poll.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #endif
 
 using namespace dev;
@@ -111,13 +118,16 @@ public:
 		Skipped
 	};
 
-	Result process();
+	/// Runs the test and prints its name, result and, on failure, details to @a _stream.
+	Result process(ostream& _stream = cout);
 
+	/// Runs all tests in @a _path, using up to @a _jobs processes, and handles failures interactively.
 	static TestStats processPath(
 		TestCreator _testCaseCreator,
 		TestOptions const& _options,
 		fs::path const& _basepath,
-		fs::path const& _path
+		fs::path const& _path,
+		unsigned _jobs
 	);
 
 	static string editor;
@@ -129,8 +139,26 @@ private:
 		Quit
 	};
 
+	/// Result and output of a test that was run in a worker process.
+	struct Outcome
+	{
+		Result result;
+		string output;
+	};
+
 	Request handleResponse(bool _exception);
 
+	/// Runs the tests in up to @a _workers forked processes, longest (i.e. largest) files first.
+	/// @returns the outcomes in the order of @a _tests. Outcomes are missing for tests that do
+	/// not match the filter or whose worker did not report a result.
+	static vector<boost::optional<Outcome>> runInWorkers(
+		TestCreator _testCaseCreator,
+		TestOptions const& _options,
+		fs::path const& _basepath,
+		vector<fs::path> const& _tests,
+		unsigned _workers
+	);
+
 	TestCreator m_testCaseCreator;
 	TestOptions const& m_options;
 	TestFilter m_filter;
@@ -145,24 +173,31 @@ private:
 string TestTool::editor;
 bool TestTool::m_exitRequested = false;
 
-TestTool::Result TestTool::process()
+TestTool::Result TestTool::process(ostream& _stream)
 {
 	bool success;
 	bool formatted{!m_options.noColor};
 	std::stringstream outputMessages;
+	auto startTime = chrono::steady_clock::now();
+	auto printTiming = [&]()
+	{
+		if (m_options.showTimings)
+			AnsiColorized(_stream, formatted, {CYAN}) <<
+				"  (" << chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - startTime).count() << " ms)" << endl;
+	};
 
 	try
 	{
 		if (m_filter.matches(m_name))
 		{
-			(AnsiColorized(cout, formatted, {BOLD}) << m_name << ": ").flush();
+			(AnsiColorized(_stream, formatted, {BOLD}) << m_name << ": ").flush();
 
 			m_test = m_testCaseCreator(TestCase::Config{m_path.string(), m_options.ipcPath.string(), m_options.evmVersion()});
 			if (m_test->validateSettings(m_options.evmVersion()))
 				success = m_test->run(outputMessages, "  ", formatted);
 			else
 			{
-				AnsiColorized(cout, formatted, {BOLD, YELLOW}) << "NOT RUN" << endl;
+				AnsiColorized(_stream, formatted, {BOLD, YELLOW}) << "NOT RUN" << endl;
 				return Result::Skipped;
 			}
 		}
@@ -171,37 +206,39 @@ TestTool::Result TestTool::process()
 	}
 	catch(boost::exception const& _e)
 	{
-		AnsiColorized(cout, formatted, {BOLD, RED}) <<
+		AnsiColorized(_stream, formatted, {BOLD, RED}) <<
 			"Exception during test: " << boost::diagnostic_information(_e) << endl;
 		return Result::Exception;
 	}
 	catch (std::exception const& _e)
 	{
-		AnsiColorized(cout, formatted, {BOLD, RED}) <<
+		AnsiColorized(_stream, formatted, {BOLD, RED}) <<
 			"Exception during test: " << _e.what() << endl;
 		return Result::Exception;
 	}
 	catch (...)
 	{
-		AnsiColorized(cout, formatted, {BOLD, RED}) <<
+		AnsiColorized(_stream, formatted, {BOLD, RED}) <<
 			"Unknown exception during test." << endl;
 		return Result::Exception;
 	}
 
 	if (success)
 	{
-		AnsiColorized(cout, formatted, {BOLD, GREEN}) << "OK" << endl;
+		AnsiColorized(_stream, formatted, {BOLD, GREEN}) << "OK" << endl;
+		printTiming();
 		return Result::Success;
 	}
 	else
 	{
-		AnsiColorized(cout, formatted, {BOLD, RED}) << "FAIL" << endl;
+		AnsiColorized(_stream, formatted, {BOLD, RED}) << "FAIL" << endl;
+		printTiming();
 
-		AnsiColorized(cout, formatted, {BOLD, CYAN}) << "  Contract:" << endl;
-		m_test->printSource(cout, "    ", formatted);
-		m_test->printUpdatedSettings(cout, "    ", formatted);
+		AnsiColorized(_stream, formatted, {BOLD, CYAN}) << "  Contract:" << endl;
+		m_test->printSource(_stream, "    ", formatted);
+		m_test->printUpdatedSettings(_stream, "    ", formatted);
 
-		cout << endl << outputMessages.str() << endl;
+		_stream << endl << outputMessages.str() << endl;
 		return Result::Failure;
 	}
 }
@@ -252,23 +289,21 @@ TestStats TestTool::processPath(
 	TestCreator _testCaseCreator,
 	TestOptions const& _options,
 	fs::path const& _basepath,
-	fs::path const& _path
+	fs::path const& _path,
+	unsigned _jobs
 )
 {
+	vector<fs::path> tests;
 	std::queue<fs::path> paths;
 	paths.push(_path);
-	int successCount = 0;
-	int testCount = 0;
-	int skippedCount = 0;
-
 	while (!paths.empty())
 	{
 		auto currentPath = paths.front();
+		paths.pop();
 
 		fs::path fullpath = _basepath / currentPath;
 		if (fs::is_directory(fullpath))
 		{
-			paths.pop();
 			for (auto const& entry: boost::iterator_range<fs::directory_iterator>(
 				fs::directory_iterator(fullpath),
 				fs::directory_iterator()
@@ -276,21 +311,40 @@ TestStats TestTool::processPath(
 				if (fs::is_directory(entry.path()) || TestCase::isTestFilename(entry.path().filename()))
 					paths.push(currentPath / entry.path().filename());
 		}
-		else if (m_exitRequested)
-		{
-			++testCount;
-			paths.pop();
-		}
 		else
+			tests.push_back(currentPath);
+	}
+
+	vector<boost::optional<Outcome>> outcomes(tests.size());
+	unsigned workers = workerCount(tests.size(), _jobs);
+	if (workers > 1)
+		outcomes = runInWorkers(_testCaseCreator, _options, _basepath, tests, workers);
+
+	int successCount = 0;
+	int testCount = 0;
+	int skippedCount = 0;
+
+	for (size_t i = 0; i < tests.size(); ++i)
+	{
+		++testCount;
+		if (m_exitRequested)
+			continue;
+
+		TestTool testTool(
+			_testCaseCreator,
+			_options,
+			_basepath / tests[i],
+			tests[i].string()
+		);
+		// Failures are run again here, so that they can be handled interactively.
+		boost::optional<Outcome> const& outcome = outcomes[i];
+		bool finished = outcome && (outcome->result == Result::Success || outcome->result == Result::Skipped);
+		if (finished)
+			cout << outcome->output;
+
+		while (true)
 		{
-			++testCount;
-			TestTool testTool(
-				_testCaseCreator,
-				_options,
-				fullpath,
-				currentPath.string()
-			);
-			auto result = testTool.process();
+			auto result = finished ? outcome->result : testTool.process();
 
 			switch(result)
 			{
@@ -299,33 +353,134 @@ TestStats TestTool::processPath(
 				switch(testTool.handleResponse(result == Result::Exception))
 				{
 				case Request::Quit:
-					paths.pop();
 					m_exitRequested = true;
 					break;
 				case Request::Rerun:
 					cout << "Re-running test case..." << endl;
-					--testCount;
-					break;
+					continue;
 				case Request::Skip:
-					paths.pop();
 					++skippedCount;
 					break;
 				}
 				break;
 			case Result::Success:
-				paths.pop();
 				++successCount;
 				break;
 			case Result::Skipped:
-				paths.pop();
 				++skippedCount;
 				break;
 			}
+			break;
 		}
 	}
 
 	return { successCount, testCount, skippedCount };
+}
 
+vector<boost::optional<TestTool::Outcome>> TestTool::runInWorkers(
+	TestCreator _testCaseCreator,
+	TestOptions const& _options,
+	fs::path const& _basepath,
+	vector<fs::path> const& _tests,
+	unsigned _workers
+)
+{
+	vector<boost::optional<Outcome>> outcomes(_tests.size());
+#if defined(_WIN32)
+	(void)_testCaseCreator;
+	(void)_options;
+	(void)_basepath;
+	(void)_workers;
+#else
+	TestFilter filter{_options.testFilter};
+	vector<pair<uintmax_t, size_t>> queue;
+	for (size_t i = 0; i < _tests.size(); ++i)
+		if (filter.matches(_tests[i].string()))
+			queue.emplace_back(fs::file_size(_basepath / _tests[i]), i);
+	// Start with the largest files, since they usually take longest (e.g. SMT checker tests),
+	// so that the workers are not stalled by a long test at the end.
+	stable_sort(queue.begin(), queue.end(), [](auto const& _a, auto const& _b) { return _a.first > _b.first; });
+
+	struct Worker
+	{
+		pid_t pid;
+		int fd;
+		size_t test;
+		string data;
+	};
+	vector<Worker> running;
+	auto next = queue.begin();
+	while (next != queue.end() || !running.empty())
+	{
+		// Every worker process runs a single test, idle slots take the next one from the queue.
+		while (next != queue.end() && running.size() < _workers)
+		{
+			size_t test = (next++)->second;
+			int fds[2];
+			if (pipe(fds) != 0)
+			{
+				// Remaining tests are run in the main process.
+				next = queue.end();
+				break;
+			}
+			cout.flush();
+			pid_t pid = fork();
+			if (pid == 0)
+			{
+				close(fds[0]);
+				stringstream output;
+				TestTool testTool(_testCaseCreator, _options, _basepath / _tests[test], _tests[test].string());
+				Result result = testTool.process(output);
+				string data = char(result) + output.str();
+				for (size_t written = 0; written < data.size();)
+				{
+					ssize_t count = write(fds[1], data.data() + written, data.size() - written);
+					if (count <= 0)
+						break;
+					written += size_t(count);
+				}
+				_exit(0);
+			}
+			close(fds[1]);
+			if (pid < 0)
+			{
+				close(fds[0]);
+				next = queue.end();
+				break;
+			}
+			running.push_back(Worker{pid, fds[0], test, {}});
+		}
+		if (running.empty())
+			break;
+
+		vector<pollfd> pollFds;
+		for (auto const& worker: running)
+			pollFds.push_back(pollfd{worker.fd, POLLIN, 0});
+		if (poll(pollFds.data(), pollFds.size(), -1) < 0)
+			continue;
+
+		for (size_t i = running.size(); i > 0; --i)
+		{
+			Worker& worker = running[i - 1];
+			if (!pollFds[i - 1].revents)
+				continue;
+			char buffer[4096];
+			ssize_t count = read(worker.fd, buffer, sizeof(buffer));
+			if (count > 0)
+				worker.data.append(buffer, size_t(count));
+			else
+			{
+				close(worker.fd);
+				waitpid(worker.pid, nullptr, 0);
+				// Tests whose worker crashed are run again in the main process.
+				if (!worker.data.empty())
+					outcomes[worker.test] = Outcome{Result(worker.data.front()), worker.data.substr(1)};
+				running.erase(running.begin() + ptrdiff_t(i - 1));
+			}
+		}
+	}
+#endif
+	return outcomes;
 }
 
 namespace
@@ -356,7 +511,8 @@ boost::optional<TestStats> runTestSuite(
 	TestOptions const& _options,
 	fs::path const& _basePath,
 	fs::path const& _subdirectory,
-	string const& _name
+	string const& _name,
+	unsigned _jobs
 )
 {
 	fs::path testPath{_basePath / _subdirectory};
@@ -372,7 +528,8 @@ boost::optional<TestStats> runTestSuite(
 		_testCaseCreator,
 		_options,
 		_basePath,
-		_subdirectory
+		_subdirectory,
+		_jobs
 	);
 
 	if (stats.skippedCount != stats.testCount)
@@ -433,7 +590,9 @@ int main(int argc, char const *argv[])
 			options,
 			options.testPath / ts.path,
 			ts.subpath,
-			ts.title
+			ts.title,
+			// Tests using IPC share the state of the node.
+			ts.ipc ? 1 : options.jobs
 		);
 		if (stats)
 			global_stats += *stats;
@@ -32,9 +32,8 @@ void yulFuzzerUtil::interpret(
 	state.maxTraceSize = _maxTraceSize;
 	state.maxSteps = _maxSteps;
 	state.maxMemSize = _maxMemory;
-	Interpreter interpreter(state);
-	interpreter(*_ast);
+	CompiledInterpreter(*_ast).run(state);
 	_os << "Trace:" << endl;
-	for (auto const& line: interpreter.trace())
+	for (auto const& line: state.trace)
 		_os << "  " << line << endl;
 }
@@ -0,0 +1,434 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Yul interpreter that executes a pre-translated form of the code.
+ */
+
+#include <test/tools/yulInterpreter/CompiledInterpreter.h>
+
+#include <test/tools/yulInterpreter/EVMInstructionInterpreter.h>
+
+#include <libyul/AsmData.h>
+#include <libyul/Utilities.h>
+
+#include <liblangutil/Exceptions.h>
+
+#include <map>
+
+using namespace std;
+using namespace dev;
+using namespace yul;
+using namespace yul::test;
+
+namespace
+{
+
+/// Counts the execution of a block, in the same way as Interpreter does.
+void countStep(InterpreterState& _state)
+{
+	_state.numSteps++;
+	if (_state.maxSteps > 0 && _state.numSteps >= _state.maxSteps)
+	{
+		_state.trace.emplace_back("Interpreter execution step limit reached.");
+		throw StepLimitReached();
+	}
+}
+
+}
+
+/**
+ * Translates the AST into closures. Variables are assigned slots in the frame of the
+ * enclosing function (or the outermost block), functions are registered when their
+ * block is entered, so that they can be called before their definition.
+ */
+class CompiledInterpreter::Compiler
+{
+public:
+	explicit Compiler(vector<unique_ptr<Function>>& _functions): m_functions(_functions) {}
+
+	/// Translates the outermost block into @a o_code.
+	void compileCode(Block const& _block, Function& o_code);
+
+private:
+	CompiledStatement compile(Statement const& _statement);
+	CompiledStatement compileBlock(Block const& _block);
+	void compileFunction(FunctionDefinition const& _function);
+	CompiledStatement compileForLoop(ForLoop const& _loop);
+	CompiledStatement compileSwitch(Switch const& _switch);
+	CompiledStatement compileAssignment(
+		vector<size_t> const& _slots,
+		Expression const* _value
+	);
+
+	CompiledExpression compileExpression(Expression const& _expression);
+	CompiledMultiExpression compileMultiExpression(Expression const& _expression);
+	/// @returns a closure that evaluates @a _arguments from right to left into its argument.
+	function<void(InterpreterState&, Frame&, u256*)> compileArguments(vector<Expression> const& _arguments);
+
+	size_t newSlot(YulString _name);
+	size_t lookupVariable(YulString _name) const;
+	Function const& lookupFunction(YulString _name) const;
+
+	vector<unique_ptr<Function>>& m_functions;
+	/// Variables of the current function, innermost scope last.
+	vector<map<YulString, size_t>> m_variableScopes;
+	/// Visible functions, innermost scope last.
+	vector<map<YulString, Function*>> m_functionScopes;
+	/// Number of slots allocated in the frame of the current function.
+	size_t m_frameSize = 0;
+};
+
+CompiledInterpreter::CompiledInterpreter(Block const& _ast)
+{
+	Compiler(m_functions).compileCode(_ast, m_code);
+}
+
+void CompiledInterpreter::run(InterpreterState& _state) const
+{
+	Frame frame(m_code.frameSize);
+	m_code.body(_state, frame);
+}
+
+void CompiledInterpreter::Compiler::compileCode(Block const& _block, Function& o_code)
+{
+	m_variableScopes.emplace_back();
+	o_code.body = compileBlock(_block);
+	o_code.frameSize = m_frameSize;
+	m_variableScopes.pop_back();
+}
+
+CompiledInterpreter::CompiledStatement CompiledInterpreter::Compiler::compile(Statement const& _statement)
+{
+	if (auto const* statement = boost::get<ExpressionStatement>(&_statement))
+	{
+		if (auto const* instruction = boost::get<FunctionalInstruction>(&statement->expression))
+		{
+			CompiledExpression expression = compileExpression(*instruction);
+			return [expression](InterpreterState& _state, Frame& _frame) { expression(_state, _frame); };
+		}
+		CompiledMultiExpression expression = compileMultiExpression(statement->expression);
+		return [expression](InterpreterState& _state, Frame& _frame) { expression(_state, _frame); };
+	}
+	else if (auto const* assignment = boost::get<Assignment>(&_statement))
+	{
+		solAssert(assignment->value, "");
+		vector<size_t> slots;
+		for (auto const& variable: assignment->variableNames)
+			slots.push_back(lookupVariable(variable.name));
+		return compileAssignment(slots, assignment->value.get());
+	}
+	else if (auto const* declaration = boost::get<VariableDeclaration>(&_statement))
+	{
+		// Yul does not allow shadowing, so the new variables cannot be referenced
+		// from the value and can be allocated first.
+		vector<size_t> slots;
+		for (auto const& variable: declaration->variables)
+			slots.push_back(newSlot(variable.name));
+		return compileAssignment(slots, declaration->value.get());
+	}
+	else if (auto const* ifStatement = boost::get<If>(&_statement))
+	{
+		solAssert(ifStatement->condition, "");
+		CompiledExpression condition = compileExpression(*ifStatement->condition);
+		CompiledStatement body = compileBlock(ifStatement->body);
+		return [condition, body](InterpreterState& _state, Frame& _frame)
+		{
+			if (condition(_state, _frame) != 0)
+				body(_state, _frame);
+		};
+	}
+	else if (auto const* switchStatement = boost::get<Switch>(&_statement))
+		return compileSwitch(*switchStatement);
+	else if (boost::get<FunctionDefinition>(&_statement))
+		// Functions are translated when their block is entered.
+		return [](InterpreterState&, Frame&) {};
+	else if (auto const* loop = boost::get<ForLoop>(&_statement))
+		return compileForLoop(*loop);
+	else if (boost::get<Break>(&_statement))
+		return [](InterpreterState& _state, Frame&) { _state.loopState = LoopState::Break; };
+	else if (boost::get<Continue>(&_statement))
+		return [](InterpreterState& _state, Frame&) { _state.loopState = LoopState::Continue; };
+	else if (auto const* block = boost::get<Block>(&_statement))
+		return compileBlock(*block);
+
+	solAssert(false, "Statement not supported by the compiled interpreter.");
+	return {};
+}
+
+CompiledInterpreter::CompiledStatement CompiledInterpreter::Compiler::compileBlock(Block const& _block)
+{
+	m_variableScopes.emplace_back();
+	m_functionScopes.emplace_back();
+	for (auto const& statement: _block.statements)
+		if (auto const* function = boost::get<FunctionDefinition>(&statement))
+		{
+			m_functions.emplace_back(make_unique<Function>());
+			m_functions.back()->parameterCount = function->parameters.size();
+			m_functions.back()->returnVariableCount = function->returnVariables.size();
+			m_functionScopes.back()[function->name] = m_functions.back().get();
+		}
+
+	vector<CompiledStatement> statements;
+	for (auto const& statement: _block.statements)
+	{
+		if (auto const* function = boost::get<FunctionDefinition>(&statement))
+			compileFunction(*function);
+		statements.emplace_back(compile(statement));
+	}
+
+	m_functionScopes.pop_back();
+	m_variableScopes.pop_back();
+
+	return [statements](InterpreterState& _state, Frame& _frame)
+	{
+		countStep(_state);
+		for (auto const& statement: statements)
+		{
+			statement(_state, _frame);
+			if (_state.loopState != LoopState::Default)
+				break;
+		}
+	};
+}
+
+void CompiledInterpreter::Compiler::compileFunction(FunctionDefinition const& _function)
+{
+	Function& function = *m_functionScopes.back().at(_function.name);
+
+	// Variables of the enclosing code are not visible inside the function.
+	vector<map<YulString, size_t>> outerVariables;
+	swap(outerVariables, m_variableScopes);
+	size_t outerFrameSize = m_frameSize;
+	m_frameSize = 0;
+
+	m_variableScopes.emplace_back();
+	for (auto const& parameter: _function.parameters)
+		newSlot(parameter.name);
+	for (auto const& returnVariable: _function.returnVariables)
+		newSlot(returnVariable.name);
+	function.body = compileBlock(_function.body);
+	function.frameSize = m_frameSize;
+
+	swap(outerVariables, m_variableScopes);
+	m_frameSize = outerFrameSize;
+}
+
+CompiledInterpreter::CompiledStatement CompiledInterpreter::Compiler::compileForLoop(ForLoop const& _loop)
+{
+	solAssert(_loop.condition, "");
+	// The init block does not count as a step and shares the scope with the rest of the loop.
+	m_variableScopes.emplace_back();
+	vector<CompiledStatement> pre;
+	for (auto const& statement: _loop.pre.statements)
+	{
+		solAssert(!boost::get<FunctionDefinition>(&statement), "Functions in for-loop init blocks are not supported.");
+		pre.emplace_back(compile(statement));
+	}
+	CompiledExpression condition = compileExpression(*_loop.condition);
+	CompiledStatement body = compileBlock(_loop.body);
+	CompiledStatement post = compileBlock(_loop.post);
+	m_variableScopes.pop_back();
+
+	return [pre, condition, body, post](InterpreterState& _state, Frame& _frame)
+	{
+		for (auto const& statement: pre)
+			statement(_state, _frame);
+		while (condition(_state, _frame) != 0)
+		{
+			_state.loopState = LoopState::Default;
+			body(_state, _frame);
+			if (_state.loopState == LoopState::Break)
+				break;
+
+			post(_state, _frame);
+		}
+		_state.loopState = LoopState::Default;
+	};
+}
+
+CompiledInterpreter::CompiledStatement CompiledInterpreter::Compiler::compileSwitch(Switch const& _switch)
+{
+	solAssert(_switch.expression, "");
+	solAssert(!_switch.cases.empty(), "");
+	CompiledExpression expression = compileExpression(*_switch.expression);
+	struct Case
+	{
+		bool isDefault;
+		u256 value;
+		CompiledStatement body;
+	};
+	vector<Case> cases;
+	for (auto const& c: _switch.cases)
+		cases.emplace_back(Case{!c.value, c.value ? valueOfLiteral(*c.value) : u256(0), compileBlock(c.body)});
+
+	return [expression, cases](InterpreterState& _state, Frame& _frame)
+	{
+		u256 value = expression(_state, _frame);
+		for (auto const& c: cases)
+			// Default case has to be last.
+			if (c.isDefault || c.value == value)
+			{
+				c.body(_state, _frame);
+				break;
+			}
+	};
+}
+
+CompiledInterpreter::CompiledStatement CompiledInterpreter::Compiler::compileAssignment(
+	vector<size_t> const& _slots,
+	Expression const* _value
+)
+{
+	if (!_value)
+		return [_slots](InterpreterState&, Frame& _frame)
+		{
+			for (size_t slot: _slots)
+				_frame[slot] = 0;
+		};
+	else if (_slots.size() == 1)
+	{
+		size_t slot = _slots.front();
+		CompiledExpression value = compileExpression(*_value);
+		return [slot, value](InterpreterState& _state, Frame& _frame)
+		{
+			_frame[slot] = value(_state, _frame);
+		};
+	}
+	else
+	{
+		CompiledMultiExpression value = compileMultiExpression(*_value);
+		return [_slots, value](InterpreterState& _state, Frame& _frame)
+		{
+			vector<u256> values = value(_state, _frame);
+			solAssert(values.size() == _slots.size(), "");
+			for (size_t i = 0; i < values.size(); ++i)
+				_frame[_slots[i]] = values[i];
+		};
+	}
+}
+
+CompiledInterpreter::CompiledExpression CompiledInterpreter::Compiler::compileExpression(Expression const& _expression)
+{
+	if (auto const* literal = boost::get<Literal>(&_expression))
+	{
+		u256 value = valueOfLiteral(*literal);
+		return [value](InterpreterState&, Frame&) { return value; };
+	}
+	else if (auto const* identifier = boost::get<Identifier>(&_expression))
+	{
+		size_t slot = lookupVariable(identifier->name);
+		return [slot](InterpreterState&, Frame& _frame) { return _frame[slot]; };
+	}
+	else if (auto const* instruction = boost::get<FunctionalInstruction>(&_expression))
+	{
+		size_t argumentCount = instruction->arguments.size();
+		auto arguments = compileArguments(instruction->arguments);
+		dev::eth::Instruction opcode = instruction->instruction;
+		return [argumentCount, arguments, opcode](InterpreterState& _state, Frame& _frame)
+		{
+			vector<u256> values(argumentCount);
+			arguments(_state, _frame, values.data());
+			return EVMInstructionInterpreter(_state).eval(opcode, values);
+		};
+	}
+	else if (auto const* call = boost::get<FunctionCall>(&_expression))
+	{
+		Function const& function = lookupFunction(call->functionName.name);
+		solAssert(function.returnVariableCount == 1, "");
+		solAssert(call->arguments.size() == function.parameterCount, "");
+		Function const* callee = &function;
+		auto arguments = compileArguments(call->arguments);
+		return [callee, arguments](InterpreterState& _state, Frame& _frame)
+		{
+			Frame frame(callee->frameSize);
+			arguments(_state, _frame, frame.data());
+			callee->body(_state, frame);
+			return frame[callee->parameterCount];
+		};
+	}
+
+	solAssert(false, "Expression not supported by the compiled interpreter.");
+	return {};
+}
+
+CompiledInterpreter::CompiledMultiExpression CompiledInterpreter::Compiler::compileMultiExpression(
+	Expression const& _expression
+)
+{
+	if (auto const* call = boost::get<FunctionCall>(&_expression))
+	{
+		Function const& function = lookupFunction(call->functionName.name);
+		solAssert(call->arguments.size() == function.parameterCount, "");
+		Function const* callee = &function;
+		auto arguments = compileArguments(call->arguments);
+		return [callee, arguments](InterpreterState& _state, Frame& _frame)
+		{
+			Frame frame(callee->frameSize);
+			arguments(_state, _frame, frame.data());
+			callee->body(_state, frame);
+			auto returnValues = frame.begin() + callee->parameterCount;
+			return vector<u256>(returnValues, returnValues + callee->returnVariableCount);
+		};
+	}
+
+	// Everything else evaluates to a single value.
+	CompiledExpression expression = compileExpression(_expression);
+	return [expression](InterpreterState& _state, Frame& _frame)
+	{
+		return vector<u256>{expression(_state, _frame)};
+	};
+}
+
+function<void(InterpreterState&, CompiledInterpreter::Frame&, u256*)>
+CompiledInterpreter::Compiler::compileArguments(vector<Expression> const& _arguments)
+{
+	vector<CompiledExpression> arguments;
+	for (auto const& argument: _arguments)
+		arguments.emplace_back(compileExpression(argument));
+	return [arguments](InterpreterState& _state, Frame& _frame, u256* o_values)
+	{
+		// Arguments are evaluated from right to left.
+		for (size_t i = arguments.size(); i > 0; --i)
+			o_values[i - 1] = arguments[i - 1](_state, _frame);
+	};
+}
+
+size_t CompiledInterpreter::Compiler::newSlot(YulString _name)
+{
+	solAssert(!m_variableScopes.empty(), "");
+	solAssert(!m_variableScopes.back().count(_name), "");
+	m_variableScopes.back()[_name] = m_frameSize;
+	return m_frameSize++;
+}
+
+size_t CompiledInterpreter::Compiler::lookupVariable(YulString _name) const
+{
+	for (auto scope = m_variableScopes.rbegin(); scope != m_variableScopes.rend(); ++scope)
+		if (scope->count(_name))
+			return scope->at(_name);
+	solAssert(false, "Unknown variable " + _name.str() + ".");
+	return 0;
+}
+
+CompiledInterpreter::Function const& CompiledInterpreter::Compiler::lookupFunction(YulString _name) const
+{
+	for (auto scope = m_functionScopes.rbegin(); scope != m_functionScopes.rend(); ++scope)
+		if (scope->count(_name))
+			return *scope->at(_name);
+	solAssert(false, "Unknown function " + _name.str() + ".");
+	return *m_functions.front();
+}
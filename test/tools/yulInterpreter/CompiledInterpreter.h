@@ -0,0 +1,80 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+/**
+ * Yul interpreter that executes a pre-translated form of the code.
+ */
+
+#pragma once
+
+#include <test/tools/yulInterpreter/Interpreter.h>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace yul
+{
+namespace test
+{
+
+/**
+ * Alternative execution engine for the Yul interpreter.
+ *
+ * The code is translated once into a tree of closures in which variables are resolved
+ * to slots in a per-call frame and function calls to the translated function bodies.
+ * Execution does not need any name lookups or visitor dispatch, but has exactly the same
+ * effects on the InterpreterState as Interpreter, including the trace, the step limit and
+ * the handling of break and continue.
+ *
+ * The code has to be valid, i.e. successfully analyzed, but does not need to be disambiguated.
+ */
+class CompiledInterpreter
+{
+public:
+	explicit CompiledInterpreter(Block const& _ast);
+
+	/// Executes the code on @a _state. Can be called multiple times.
+	/// Throws the same InterpreterTerminatedGeneric exceptions as Interpreter.
+	void run(InterpreterState& _state) const;
+
+private:
+	class Compiler;
+
+	using Frame = std::vector<dev::u256>;
+	using CompiledStatement = std::function<void(InterpreterState&, Frame&)>;
+	/// Expression that evaluates to exactly one value.
+	using CompiledExpression = std::function<dev::u256(InterpreterState&, Frame&)>;
+	/// Expression that evaluates to any number of values.
+	using CompiledMultiExpression = std::function<std::vector<dev::u256>(InterpreterState&, Frame&)>;
+
+	struct Function
+	{
+		size_t parameterCount = 0;
+		size_t returnVariableCount = 0;
+		/// Number of variable slots, starting with parameters and return variables.
+		size_t frameSize = 0;
+		CompiledStatement body;
+	};
+
+	/// All functions, referenced by the translated code.
+	std::vector<std::unique_ptr<Function>> m_functions;
+	/// The translated outermost block.
+	Function m_code;
+};
+
+}
+}